@@ -0,0 +1,386 @@
+//--------------------------------------------------------
+//      tp4_design.c
+//--------------------------------------------------------
+//	Description :	Calcul du compensateur de la boucle de tension
+//                  (mode tension, APP_REGUL_COMP) et génération de
+//                  comp_coef.h
+//
+//  Méthode : facteur K (Venable) sur le modèle petit signal moyen
+//      buck  : Gvd = Vin . Zo / (Zo + rl + sL),  Zo = R // (ESR + 1/sC)
+//      boost : Gvd = Vo/(1-D) . (1 - sL/(R.(1-D)²)) . (1 + s.ESR.C)
+//                    / (1 + sL/(R.(1-D)²) + s²LC/(1-D)²)
+//      retard de boucle : exp(-s.T.(d + 1/2)), d = retard de calcul
+//      (échantillon -> nouveau OC1RS, en périodes), 1/2 : bloqueur PWM
+//  Le déphasage du procédé à fc fixe la remontée de phase nécessaire ;
+//  type II (1 zéro, 1 pôle) jusqu'à 90°, type III (2 zéros, 2 pôles)
+//  au-delà. Le compensateur continu est discrétisé par Tustin puis son
+//  gain est recalé pour un gain de boucle unitaire exactement à fc.
+//  Les marges affichées sont celles de la boucle discrète.
+//
+//  Usage : tp4_design [options]
+//      -P clé=valeur   paramètre du convertisseur (voir plant.c)
+//      -T v            tension de sortie (défaut 5 V)
+//      -f Hz           fréquence d'échantillonnage (PWM_FREQ / CTRL_DECIM)
+//      -c Hz           fréquence de coupure visée (défaut f/10)
+//      -m deg          marge de phase visée (défaut 50°)
+//      -d périodes     retard de calcul (défaut 1)
+//      -o fichier      en-tête généré (défaut : sortie standard)
+//--------------------------------------------------------
+
+#include <complex.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "plant.h"
+#include "comp.h"
+
+#define DESIGN_ADC_MAX      1023.0
+#define DESIGN_SCAN_POINTS  2000
+
+typedef double complex cplx;
+
+typedef struct
+{
+    PLANT_PARAM plant;
+    double vOut;        // Point de fonctionnement (V)
+    double fs;          // Fréquence d'échantillonnage (Hz)
+    double fc;          // Coupure visée (Hz)
+    double pm;          // Marge de phase visée (°)
+    double delay;       // Retard de calcul (périodes)
+} DESIGN;
+
+//------------------------------------------------------------------------------
+// Procédé : rapport cyclique -> Vout, retard compris
+
+static cplx _Plant(const DESIGN *d, double w)
+{
+    const PLANT_PARAM *p = &d->plant;
+    cplx s = I * w;
+    cplx g;
+
+    if (p->topology == PLANT_BUCK)
+    {
+        cplx zc = p->esr + 1.0 / (s * p->c);
+        cplx zo = (p->rLoad > 0.0) ? (p->rLoad * zc) / (p->rLoad + zc) : zc;
+        g = p->vin * zo / (zo + p->rl + s * p->l);
+    }
+    else
+    {
+        double m = p->vin / d->vOut;            // 1 - D
+        double r = (p->rLoad > 0.0) ? p->rLoad : 1e6;
+        double le = p->l / (m * m);             // Inductance équivalente
+        g = (d->vOut / m) * (1.0 - s * le / r) * (1.0 + s * p->esr * p->c)
+            / (1.0 + s * le / r + s * s * le * p->c);
+    }
+    return g * cexp(-s * (d->delay + 0.5) / d->fs);
+}
+
+//------------------------------------------------------------------------------
+// Polynômes (puissances croissantes)
+
+static void _PolyMul(double *r, const double *a, int na, const double *b, int nb)
+{
+    int i, j;
+
+    for (i = 0; i < na + nb - 1; i++)
+        r[i] = 0.0;
+    for (i = 0; i < na; i++)
+        for (j = 0; j < nb; j++)
+            r[i + j] += a[i] * b[j];
+}
+
+// Tustin : P(s) d'ordre <= n -> coefficients en z^-1 de P(s).(1 + z^-1)^n,
+// s = 2/T . (1 - z^-1) / (1 + z^-1)
+static void _Bilinear(double *out, const double *p, int deg, int n, double t)
+{
+    double acc[COMP_ORDER_MAX + 1];
+    double tmp[COMP_ORDER_MAX + 1];
+    const double minus[2] = { 1.0, -1.0 };
+    const double plus[2] = { 1.0, 1.0 };
+    double k = 1.0;
+    int i, j, len;
+
+    for (i = 0; i <= n; i++)
+        out[i] = 0.0;
+
+    for (i = 0; i <= deg; i++, k *= 2.0 / t)
+    {
+        acc[0] = 1.0;
+        len = 1;
+        for (j = 0; j < i; j++, len++)
+        {
+            _PolyMul(tmp, acc, len, minus, 2);
+            memcpy(acc, tmp, sizeof(double) * (len + 1));
+        }
+        for (j = i; j < n; j++, len++)
+        {
+            _PolyMul(tmp, acc, len, plus, 2);
+            memcpy(acc, tmp, sizeof(double) * (len + 1));
+        }
+        for (j = 0; j <= n; j++)
+            out[j] += p[i] * k * acc[j];
+    }
+}
+
+// Réponse du compensateur discret en z = exp(jwT)
+static cplx _Comp(const COMP_FLOAT_PARAM *c, double w, double fs)
+{
+    cplx zi = cexp(-I * w / fs);
+    cplx num = 0.0, den = 1.0, zk = 1.0;
+    int k;
+
+    for (k = 0; k <= c->type; k++, zk *= zi)
+    {
+        num += c->b[k] * zk;
+        if (k > 0)
+            den -= c->a[k] * zk;
+    }
+    return num / den;
+}
+
+static double _Deg(double rad)
+{
+    return rad * 180.0 / M_PI;
+}
+
+//------------------------------------------------------------------------------
+// Facteur K et discrétisation
+
+static int _Design(const DESIGN *d, COMP_FLOAT_PARAM *c, double *boostOut)
+{
+    double wc = 2.0 * M_PI * d->fc;
+    double phase = _Deg(carg(_Plant(d, wc)));
+    double boost, k, wz, wp, gain;
+    double num[4], den[4];
+    double nz[COMP_ORDER_MAX + 1], dz[COMP_ORDER_MAX + 1];
+    int n, i;
+
+    // Phase du procédé ramenée dans ]-360, 0]
+    while (phase > 0.0)
+        phase -= 360.0;
+    boost = d->pm - 90.0 - phase;
+    *boostOut = boost;
+    if (boost < 0.0)
+        boost = 0.0;
+    if (boost >= 170.0)
+        return -1;
+
+    if (boost <= 90.0)
+    {
+        n = 2;
+        k = tan((boost / 2.0 + 45.0) * M_PI / 180.0);
+        wz = wc / k;
+        wp = wc * k;
+        num[0] = 1.0;       num[1] = 1.0 / wz;
+        den[0] = 0.0;       den[1] = 1.0;       den[2] = 1.0 / wp;
+    }
+    else
+    {
+        n = 3;
+        k = pow(tan((boost / 4.0 + 45.0) * M_PI / 180.0), 2.0);
+        wz = wc / sqrt(k);
+        wp = wc * sqrt(k);
+        num[0] = 1.0;       num[1] = 2.0 / wz;  num[2] = 1.0 / (wz * wz);
+        den[0] = 0.0;       den[1] = 1.0;       den[2] = 2.0 / wp;
+        den[3] = 1.0 / (wp * wp);
+    }
+
+    _Bilinear(nz, num, n - 1, n, 1.0 / d->fs);
+    _Bilinear(dz, den, n, n, 1.0 / d->fs);
+
+    memset(c, 0, sizeof(*c));
+    c->type = (n == 2) ? COMP_2P2Z : COMP_3P3Z;
+    for (i = 0; i <= n; i++)
+    {
+        c->b[i] = (float)(nz[i] / dz[0]);
+        if (i > 0)
+            c->a[i] = (float)(-dz[i] / dz[0]);
+    }
+    c->outMin = 0.0f;
+    c->outMax = 1.0f;
+
+    // Gain : |C.G| = 1 à fc sur la boucle discrète
+    gain = 1.0 / cabs(_Comp(c, wc, d->fs) * _Plant(d, wc));
+    for (i = 0; i <= n; i++)
+        c->b[i] = (float)(c->b[i] * gain);
+    return 0;
+}
+
+// Marges de la boucle discrète, phase déroulée :
+//  fc : dernière traversée du gain unité, pm : marge de phase minimale sur
+//  toutes les traversées (un pic de résonance peut en créer plusieurs),
+//  gm : marge de gain au premier passage à -180° au-delà de fc
+static void _Margins(const DESIGN *d, const COMP_FLOAT_PARAM *c,
+                     double *fc, double *pm, double *gm)
+{
+    double magPrev = 0.0, phPrev = 0.0, unwrap = 0.0;
+    int i;
+
+    *fc = *pm = *gm = NAN;
+    for (i = 0; i <= DESIGN_SCAN_POINTS; i++)
+    {
+        double f = d->fs / 2.0 * pow(10.0, -3.0 * (1.0 - (double)i / DESIGN_SCAN_POINTS));
+        cplx l = _Comp(c, 2.0 * M_PI * f, d->fs) * _Plant(d, 2.0 * M_PI * f);
+        double mag = cabs(l);
+        double ph = _Deg(carg(l)) + unwrap;
+
+        if (i > 0 && ph - phPrev > 180.0)
+        {
+            unwrap -= 360.0;
+            ph -= 360.0;
+        }
+        if (i > 0 && (magPrev >= 1.0) != (mag >= 1.0))
+        {
+            double m = 180.0 + ph;
+            *fc = f;
+            *gm = NAN;
+            if (isnan(*pm) || m < *pm)
+                *pm = m;
+        }
+        if (i > 0 && !isnan(*fc) && isnan(*gm) && phPrev > -180.0 && ph <= -180.0)
+            *gm = -20.0 * log10(mag);
+        magPrev = mag;
+        phPrev = ph;
+    }
+}
+
+//------------------------------------------------------------------------------
+// En-tête généré
+
+static void _Header(FILE *out, const DESIGN *d, const COMP_FLOAT_PARAM *c,
+                    const COMP_FIX_PARAM *x, double lsb,
+                    double fc, double pm, double gm, int argc, char **argv)
+{
+    int i, n = c->type;
+
+    fprintf(out, "//--------------------------------------------------------\n");
+    fprintf(out, "//      comp_coef.h\n");
+    fprintf(out, "//--------------------------------------------------------\n");
+    fprintf(out, "//\tDescription :\tCoefficients du compensateur de tension\n");
+    fprintf(out, "//                  GENERE par tp4_design, ne pas modifier :\n");
+    fprintf(out, "//                  make -C firmware/host coef COEF_ARGS=\"...\"\n");
+    fprintf(out, "//\n");
+    fprintf(out, "//  Commande :");
+    for (i = 1; i < argc; i++)
+        fprintf(out, " %s", argv[i]);
+    fprintf(out, "\n");
+    fprintf(out, "//  Procédé : %s, Vin %.3g V, Vout %.3g V, L %.3g H, rl %.3g ohm,\n",
+            d->plant.topology == PLANT_BUCK ? "buck" : "boost",
+            d->plant.vin, d->vOut, d->plant.l, d->plant.rl);
+    fprintf(out, "//            C %.3g F, ESR %.3g ohm, charge %.3g ohm\n",
+            d->plant.c, d->plant.esr, d->plant.rLoad);
+    fprintf(out, "//  Echantillonnage %.0f Hz, retard de calcul %.2f T\n", d->fs, d->delay);
+    fprintf(out, "//  Visé  : fc %.0f Hz, marge de phase %.1f°\n", d->fc, d->pm);
+    fprintf(out, "//  Obtenu : fc %.0f Hz, marge de phase %.1f°, marge de gain %.1f dB\n",
+            fc, pm, gm);
+    fprintf(out, "//--------------------------------------------------------\n\n");
+    fprintf(out, "#ifndef COMP_COEF_H\n#define COMP_COEF_H\n\n#include \"comp.h\"\n\n");
+    fprintf(out, "#define COMP_COEF_FS_HZ     %luul   // Cadence de régulation\n\n",
+            (unsigned long)(d->fs + 0.5));
+
+    fprintf(out, "// Référence flottante (erreur en V)\n");
+    fprintf(out, "#define COMP_COEF_FLOAT \\\n    { %s, \\\n      {",
+            n == 2 ? "COMP_2P2Z" : "COMP_3P3Z");
+    for (i = 0; i <= COMP_ORDER_MAX; i++)
+        fprintf(out, " %#.9gf%s", c->b[i], i < COMP_ORDER_MAX ? "," : "");
+    fprintf(out, " }, \\\n      {");
+    for (i = 0; i <= COMP_ORDER_MAX; i++)
+        fprintf(out, " %#.9gf%s", c->a[i], i < COMP_ORDER_MAX ? "," : "");
+    fprintf(out, " }, \\\n      %#.9gf, %#.9gf }\n\n", c->outMin, c->outMax);
+
+    fprintf(out, "// Virgule fixe (erreur en codes de %.6g V, coefficients Q%u)\n",
+            lsb, 31 - x->shift);
+    fprintf(out, "#define COMP_COEF_FIX \\\n    { %s, %u, \\\n      {",
+            n == 2 ? "COMP_2P2Z" : "COMP_3P3Z", x->shift);
+    for (i = 0; i <= COMP_ORDER_MAX; i++)
+        fprintf(out, " %ld%s", (long)x->b[i], i < COMP_ORDER_MAX ? "," : "");
+    fprintf(out, " }, \\\n      {");
+    for (i = 0; i <= COMP_ORDER_MAX; i++)
+        fprintf(out, " %ld%s", (long)x->a[i], i < COMP_ORDER_MAX ? "," : "");
+    fprintf(out, " }, \\\n      %ld, %ld }\n\n", (long)x->outMin, (long)x->outMax);
+    fprintf(out, "#endif\n");
+}
+
+static void _Usage(const char *name)
+{
+    fprintf(stderr,
+            "usage: %s [-P key=val]... [-T vout] [-f fs] [-c fc] [-m pm] [-d delay] [-o file]\n",
+            name);
+}
+
+int main(int argc, char **argv)
+{
+    DESIGN d;
+    COMP_FLOAT_PARAM c;
+    COMP_FIX_PARAM x;
+    const char *outPath = NULL;
+    FILE *out = stdout;
+    double lsb, fc, pm, gm, boost;
+    int opt;
+
+    PLANT_DefaultParam(&d.plant);
+    d.vOut = 5.0;
+    d.fs = 10000.0;
+    d.fc = 0.0;
+    d.pm = 50.0;
+    d.delay = 1.0;
+
+    while ((opt = getopt(argc, argv, "P:T:f:c:m:d:o:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'P':
+                if (!PLANT_ParseSet(&d.plant, optarg))
+                {
+                    fprintf(stderr, "bad plant parameter '%s'\n", optarg);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'T': d.vOut = atof(optarg); break;
+            case 'f': d.fs = atof(optarg); break;
+            case 'c': d.fc = atof(optarg); break;
+            case 'm': d.pm = atof(optarg); break;
+            case 'd': d.delay = atof(optarg); break;
+            case 'o': outPath = optarg; break;
+            default:
+                _Usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+    if (d.fc <= 0.0)
+        d.fc = d.fs / 10.0;
+    if (d.fs <= 0.0 || d.fc >= d.fs / 2.0)
+    {
+        fprintf(stderr, "crossover must be below fs/2\n");
+        return EXIT_FAILURE;
+    }
+
+    if (_Design(&d, &c, &boost) != 0)
+    {
+        fprintf(stderr, "phase boost %.0f deg out of reach, lower -c or -m\n", boost);
+        return EXIT_FAILURE;
+    }
+    lsb = d.plant.vref / DESIGN_ADC_MAX * d.plant.vGain;
+    if (!COMP_InitFix(&x, &c, (float)lsb))
+    {
+        fprintf(stderr, "coefficients out of fixed-point range\n");
+        return EXIT_FAILURE;
+    }
+    _Margins(&d, &c, &fc, &pm, &gm);
+
+    fprintf(stderr, "%s, boost %.1f deg: fc %.0f Hz, PM %.1f deg, GM %.1f dB\n",
+            c.type == COMP_2P2Z ? "type II (2P2Z)" : "type III (3P3Z)",
+            boost, fc, pm, gm);
+
+    if (outPath != NULL && (out = fopen(outPath, "w")) == NULL)
+    {
+        perror(outPath);
+        return EXIT_FAILURE;
+    }
+    _Header(out, &d, &c, &x, lsb, fc, pm, gm, argc, argv);
+    if (out != stdout)
+        fclose(out);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,2 @@
+// Remplaçant hôte : voir host_plib.h
+#include "host_plib.h"
@@ -0,0 +1,3 @@
+// Remplaçant hôte : voir host_plib.h
+#include "host_plib.h"
+#include "driver/oc/drv_oc_static.h"
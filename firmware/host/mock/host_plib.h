@@ -0,0 +1,780 @@
+//--------------------------------------------------------
+//      host_plib.h
+//--------------------------------------------------------
+//	Description :	Remplaçants hôte (Linux) de PLIB / Harmony
+//                  Les en-têtes "peripheral/..." , "system/..." et
+//                  "driver/..." du répertoire mock/ redirigent tous ici.
+//                  Les registres simulés sont regroupés dans hostPlib,
+//                  accessible par le simulateur (sim/host_sim.c).
+//--------------------------------------------------------
+
+#ifndef HOST_PLIB_H
+#define HOST_PLIB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+extern "C" {
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// Section: Compilateur XC32
+// *****************************************************************************
+
+#define __ISR(vector, ...)
+#define Nop()               do { } while (0)
+
+#define _TIMER_1_VECTOR     4
+#define _OUTPUT_COMPARE_1_VECTOR 6
+#define _TIMER_2_VECTOR     8
+#define _ADC_VECTOR         23
+#define _I2C_1_VECTOR       25
+#define _COMPARATOR_1_VECTOR 26
+#define _CHANGE_NOTICE_VECTOR 34
+
+// Registre Count du CP0 : horloge monotone de l'hôte ramenée à SYSCLK / 2.
+// Les durées mesurées sont celles de l'hôte, pas celles du PIC32.
+uint32_t _CP0_GET_COUNT(void);
+
+// *****************************************************************************
+// Section: System services (sys_common / sys_module / clk / devcon)
+// *****************************************************************************
+
+typedef uintptr_t SYS_MODULE_OBJ;
+typedef unsigned short SYS_MODULE_INDEX;
+typedef union { uint8_t value; } SYS_MODULE_INIT;
+
+typedef enum
+{
+    SYS_STATUS_ERROR = -1,
+    SYS_STATUS_UNINITIALIZED = 0,
+    SYS_STATUS_BUSY = 1,
+    SYS_STATUS_READY = 2
+} SYS_STATUS;
+
+#define SYS_MODULE_OBJ_INVALID  ((SYS_MODULE_OBJ) -1)
+#define SYS_DEVCON_INDEX_0      0
+
+typedef enum { CLK_BUS_PERIPHERAL_1 = 0 } CLK_BUSES_PERIPHERAL;
+typedef struct { uint32_t systemClockFrequencyHz; } SYS_CLK_INIT;
+
+#define CLK_BUS_FOR_TIMER_PERIPHERAL    CLK_BUS_PERIPHERAL_1
+
+void SYS_Initialize(void *data);
+void SYS_Tasks(void);
+
+void SYS_CLK_Initialize(const SYS_CLK_INIT *clkInit);
+uint32_t SYS_CLK_SystemFrequencyGet(void);
+uint32_t SYS_CLK_PeripheralFrequencyGet(CLK_BUSES_PERIPHERAL peripheralBus);
+
+SYS_MODULE_OBJ SYS_DEVCON_Initialize(const SYS_MODULE_INDEX index, const SYS_MODULE_INIT * const init);
+void SYS_DEVCON_PerformanceConfig(unsigned int sysclk);
+void SYS_DEVCON_JTAGEnable(void);
+void SYS_DEVCON_JTAGDisable(void);
+
+void SYS_PORTS_Initialize(void);
+
+void SYS_INT_Initialize(void);
+void SYS_INT_Enable(void);
+bool SYS_INT_Disable(void);
+void SYS_INT_Restore(bool state);
+
+// *****************************************************************************
+// Section: PLIB_INT
+// *****************************************************************************
+
+typedef enum { INT_ID_0 = 0 } INT_MODULE_ID;
+
+typedef enum
+{
+    INT_SOURCE_TIMER_1 = 0,
+    INT_SOURCE_TIMER_2,
+    INT_SOURCE_TIMER_3,
+    INT_SOURCE_ADC_1,
+    INT_SOURCE_I2C_1_MASTER,
+    INT_SOURCE_I2C_1_ERROR,
+    INT_SOURCE_OUTPUT_COMPARE_1,
+    INT_SOURCE_COMPARATOR_1,
+    INT_SOURCE_CHANGE_NOTICE_B,
+    INT_SOURCE_NUM
+} INT_SOURCE;
+
+typedef enum
+{
+    INT_VECTOR_T1 = 0,
+    INT_VECTOR_T2,
+    INT_VECTOR_T3,
+    INT_VECTOR_AD1,
+    INT_VECTOR_I2C1,
+    INT_VECTOR_OC1,
+    INT_VECTOR_CMP1,
+    INT_VECTOR_CN,
+    INT_VECTOR_NUM
+} INT_VECTOR;
+
+typedef enum
+{
+    INT_DISABLE_INTERRUPT = 0,
+    INT_PRIORITY_LEVEL1, INT_PRIORITY_LEVEL2, INT_PRIORITY_LEVEL3,
+    INT_PRIORITY_LEVEL4, INT_PRIORITY_LEVEL5, INT_PRIORITY_LEVEL6,
+    INT_PRIORITY_LEVEL7
+} INT_PRIORITY_LEVEL;
+
+typedef enum
+{
+    INT_SUBPRIORITY_LEVEL0 = 0, INT_SUBPRIORITY_LEVEL1,
+    INT_SUBPRIORITY_LEVEL2, INT_SUBPRIORITY_LEVEL3
+} INT_SUBPRIORITY_LEVEL;
+
+void PLIB_INT_Enable(INT_MODULE_ID index);
+void PLIB_INT_Disable(INT_MODULE_ID index);
+void PLIB_INT_SourceEnable(INT_MODULE_ID index, INT_SOURCE source);
+void PLIB_INT_SourceDisable(INT_MODULE_ID index, INT_SOURCE source);
+bool PLIB_INT_SourceIsEnabled(INT_MODULE_ID index, INT_SOURCE source);
+void PLIB_INT_SourceFlagSet(INT_MODULE_ID index, INT_SOURCE source);
+void PLIB_INT_SourceFlagClear(INT_MODULE_ID index, INT_SOURCE source);
+bool PLIB_INT_SourceFlagGet(INT_MODULE_ID index, INT_SOURCE source);
+void PLIB_INT_VectorPrioritySet(INT_MODULE_ID index, INT_VECTOR vector, INT_PRIORITY_LEVEL priority);
+void PLIB_INT_VectorSubPrioritySet(INT_MODULE_ID index, INT_VECTOR vector, INT_SUBPRIORITY_LEVEL subPriority);
+
+// SYS_INT par source (sys_int.h)
+bool SYS_INT_SourceDisable(INT_SOURCE source);
+void SYS_INT_SourceRestore(INT_SOURCE source, bool status);
+
+// *****************************************************************************
+// Section: PLIB_PORTS
+// *****************************************************************************
+
+typedef enum { PORTS_ID_0 = 0 } PORTS_MODULE_ID;
+typedef enum { PORT_CHANNEL_A = 0, PORT_CHANNEL_B, PORT_CHANNEL_NUM } PORTS_CHANNEL;
+typedef enum
+{
+    PORTS_BIT_POS_0 = 0, PORTS_BIT_POS_1, PORTS_BIT_POS_2, PORTS_BIT_POS_3,
+    PORTS_BIT_POS_4, PORTS_BIT_POS_5, PORTS_BIT_POS_6, PORTS_BIT_POS_7,
+    PORTS_BIT_POS_8, PORTS_BIT_POS_9, PORTS_BIT_POS_10, PORTS_BIT_POS_11,
+    PORTS_BIT_POS_12, PORTS_BIT_POS_13, PORTS_BIT_POS_14, PORTS_BIT_POS_15
+} PORTS_BIT_POS;
+
+void PLIB_PORTS_PinSet(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos);
+void PLIB_PORTS_PinClear(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos);
+void PLIB_PORTS_PinDirectionOutputSet(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos);
+void PLIB_PORTS_PinDirectionInputSet(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos);
+void PLIB_PORTS_PinToggle(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos);
+void PLIB_PORTS_PinWrite(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos, bool value);
+bool PLIB_PORTS_PinGet(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos);
+bool PLIB_PORTS_PinGetLatched(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos);
+
+// *****************************************************************************
+// Section: PLIB_TMR
+// *****************************************************************************
+
+typedef enum
+{
+    TMR_ID_1 = 0, TMR_ID_2, TMR_ID_3, TMR_ID_4, TMR_ID_5, TMR_NUMBER_OF_MODULES
+} TMR_MODULE_ID;
+
+typedef enum
+{
+    TMR_CLOCK_SOURCE_PERIPHERAL_CLOCK = 0,
+    TMR_CLOCK_SOURCE_EXTERNAL_INPUT_PIN = 1
+} TMR_CLOCK_SOURCE;
+
+typedef enum
+{
+    TMR_PRESCALE_VALUE_1 = 0, TMR_PRESCALE_VALUE_2, TMR_PRESCALE_VALUE_4,
+    TMR_PRESCALE_VALUE_8, TMR_PRESCALE_VALUE_16, TMR_PRESCALE_VALUE_32,
+    TMR_PRESCALE_VALUE_64, TMR_PRESCALE_VALUE_256
+} TMR_PRESCALE;
+
+void PLIB_TMR_Start(TMR_MODULE_ID index);
+void PLIB_TMR_Stop(TMR_MODULE_ID index);
+void PLIB_TMR_ClockSourceSelect(TMR_MODULE_ID index, TMR_CLOCK_SOURCE source);
+void PLIB_TMR_ClockSourceExternalSyncEnable(TMR_MODULE_ID index);
+void PLIB_TMR_ClockSourceExternalSyncDisable(TMR_MODULE_ID index);
+void PLIB_TMR_PrescaleSelect(TMR_MODULE_ID index, TMR_PRESCALE prescale);
+uint16_t PLIB_TMR_PrescaleGet(TMR_MODULE_ID index);
+void PLIB_TMR_Mode16BitEnable(TMR_MODULE_ID index);
+void PLIB_TMR_Counter16BitSet(TMR_MODULE_ID index, uint16_t value);
+uint16_t PLIB_TMR_Counter16BitGet(TMR_MODULE_ID index);
+void PLIB_TMR_Counter16BitClear(TMR_MODULE_ID index);
+void PLIB_TMR_Period16BitSet(TMR_MODULE_ID index, uint16_t period);
+uint16_t PLIB_TMR_Period16BitGet(TMR_MODULE_ID index);
+void PLIB_TMR_StopInIdleDisable(TMR_MODULE_ID index);
+bool PLIB_TMR_ExistsClockSource(TMR_MODULE_ID index);
+bool PLIB_TMR_ExistsClockSourceSync(TMR_MODULE_ID index);
+bool PLIB_TMR_ExistsPrescale(TMR_MODULE_ID index);
+
+// *****************************************************************************
+// Section: DRV_TMR (types communs du driver)
+// *****************************************************************************
+
+typedef void (*DRV_TMR_CALLBACK)(uintptr_t context, uint32_t alarmCount);
+
+typedef enum
+{
+    DRV_TMR_CLKSOURCE_INTERNAL = 0x00,
+    DRV_TMR_CLKSOURCE_EXTERNAL_SYNCHRONOUS = 0x01,
+    DRV_TMR_CLKSOURCE_EXTERNAL_ASYNCHRONOUS = 0x11
+} DRV_TMR_CLK_SOURCES;
+
+typedef enum
+{
+    DRV_TMR_CLIENT_STATUS_INVALID = 0,
+    DRV_TMR_CLIENT_STATUS_BUSY,
+    DRV_TMR_CLIENT_STATUS_READY,
+    DRV_TMR_CLIENT_STATUS_RUNNING
+} DRV_TMR_CLIENT_STATUS;
+
+typedef enum
+{
+    DRV_TMR_OPERATION_MODE_NONE = 0,
+    DRV_TMR_OPERATION_MODE_16_BIT,
+    DRV_TMR_OPERATION_MODE_32_BIT
+} DRV_TMR_OPERATION_MODE;
+
+typedef struct
+{
+    uint32_t dividerMax;
+    uint32_t dividerMin;
+    uint32_t dividerStep;
+} DRV_TMR_DIVIDER_RANGE;
+
+// *****************************************************************************
+// Section: PLIB_OC
+// *****************************************************************************
+
+typedef enum { OC_ID_1 = 0, OC_ID_2, OC_ID_3, OC_ID_4, OC_ID_5 } OC_MODULE_ID;
+
+typedef enum
+{
+    OC_COMPARE_TURN_OFF_MODE = 0,
+    OC_SET_HIGH_SINGLE_PULSE_MODE,
+    OC_SET_LOW_SINGLE_PULSE_MODE,
+    OC_TOGGLE_CONTINUOUS_PULSE_MODE,
+    OC_DUAL_COMPARE_SINGLE_PULSE_MODE,
+    OC_DUAL_COMPARE_CONTINUOUS_PULSE_MODE,
+    OC_COMPARE_PWM_MODE_WITHOUT_FAULT_PROTECTION,
+    OC_COMPARE_PWM_MODE_WITH_FAULT_PROTECTION
+} OC_COMPARE_MODES;
+
+typedef enum { OC_BUFFER_SIZE_16BIT = 0, OC_BUFFER_SIZE_32BIT } OC_BUFFER_SIZE;
+typedef enum { OC_TIMER_16BIT_TMR2 = 0, OC_TIMER_16BIT_TMR3 } OC_16BIT_TIMERS;
+
+void PLIB_OC_Enable(OC_MODULE_ID index);
+void PLIB_OC_Disable(OC_MODULE_ID index);
+void PLIB_OC_ModeSelect(OC_MODULE_ID index, OC_COMPARE_MODES cmpMode);
+void PLIB_OC_BufferSizeSelect(OC_MODULE_ID index, OC_BUFFER_SIZE size);
+void PLIB_OC_TimerSelect(OC_MODULE_ID index, OC_16BIT_TIMERS tmr);
+void PLIB_OC_Buffer16BitSet(OC_MODULE_ID index, uint16_t value);
+void PLIB_OC_PulseWidth16BitSet(OC_MODULE_ID index, uint16_t pulseWidth);
+bool PLIB_OC_FaultHasOccurred(OC_MODULE_ID index);
+
+// *****************************************************************************
+// Section: PLIB_CMP (comparateurs et CVREF)
+// *****************************************************************************
+
+typedef enum { CMP_ID_1 = 0, CMP_ID_2, CMP_ID_3, CMP_NUMBER_OF_MODULES } CMP_MODULE_ID;
+
+typedef enum
+{
+    CMP_NON_INVERTING_INPUT_1 = 0,      // CxINA
+    CMP_NON_INVERTING_INPUT_CDAC        // CVREF
+} CMP_NON_INVERTING_INPUT;
+
+typedef enum
+{
+    CMP_INVERTING_INPUT_1 = 0,          // CxINB
+    CMP_INVERTING_INPUT_2,              // CxINC
+    CMP_INVERTING_INPUT_3,              // CxIND
+    CMP_INVERTING_INPUT_IVREF
+} CMP_INVERTING_INPUT;
+
+typedef enum
+{
+    CMP_INTERRUPT_GENERATION_DISABLED = 0,
+    CMP_INTERRUPT_GENERATION_LOW_TO_HIGH,
+    CMP_INTERRUPT_GENERATION_HIGH_TO_LOW,
+    CMP_INTERRUPT_GENERATION_BOTH
+} CMP_INTERRUPT_EVENT;
+
+typedef enum
+{
+    CMP_CVREF_VALUE_0 = 0, CMP_CVREF_VALUE_1, CMP_CVREF_VALUE_2,
+    CMP_CVREF_VALUE_3, CMP_CVREF_VALUE_4, CMP_CVREF_VALUE_5,
+    CMP_CVREF_VALUE_6, CMP_CVREF_VALUE_7, CMP_CVREF_VALUE_8,
+    CMP_CVREF_VALUE_9, CMP_CVREF_VALUE_10, CMP_CVREF_VALUE_11,
+    CMP_CVREF_VALUE_12, CMP_CVREF_VALUE_13, CMP_CVREF_VALUE_14,
+    CMP_CVREF_VALUE_15
+} CMP_CVREF_VALUE;
+
+typedef enum
+{
+    CMP_CVREF_VOLTAGE_SOURCE_VDD = 0,
+    CMP_CVREF_VOLTAGE_SOURCE_EXTERNAL
+} CMP_CVREF_VOLTAGE_SOURCE;
+
+void PLIB_CMP_Enable(CMP_MODULE_ID index);
+void PLIB_CMP_Disable(CMP_MODULE_ID index);
+void PLIB_CMP_NonInvertingInputSelect(CMP_MODULE_ID index, CMP_NON_INVERTING_INPUT input);
+void PLIB_CMP_InvertingInputSelect(CMP_MODULE_ID index, CMP_INVERTING_INPUT input);
+void PLIB_CMP_OutputInvertEnable(CMP_MODULE_ID index);
+void PLIB_CMP_OutputInvertDisable(CMP_MODULE_ID index);
+void PLIB_CMP_InterruptEventSelect(CMP_MODULE_ID index, CMP_INTERRUPT_EVENT event);
+bool PLIB_CMP_OutputStatusGet(CMP_MODULE_ID index);
+void PLIB_CMP_CVREF_Enable(CMP_MODULE_ID index);
+void PLIB_CMP_CVREF_Disable(CMP_MODULE_ID index);
+void PLIB_CMP_CVREF_SourceVoltageSelect(CMP_MODULE_ID index, CMP_CVREF_VOLTAGE_SOURCE source);
+void PLIB_CMP_CVREF_WideRangeEnable(CMP_MODULE_ID index);
+void PLIB_CMP_CVREF_WideRangeDisable(CMP_MODULE_ID index);
+void PLIB_CMP_CVREF_ValueSelect(CMP_MODULE_ID index, CMP_CVREF_VALUE value);
+
+// *****************************************************************************
+// Section: PLIB_ADC
+// *****************************************************************************
+
+typedef uint32_t ADC_SAMPLE;
+
+typedef enum { ADC_ID_1 = 0, ADC_NUMBER_OF_MODULES } ADC_MODULE_ID;
+typedef enum { ADC_MUX_A = 0, ADC_MUX_B } ADC_MUX;
+typedef enum { ADC_FILLING_BUF_0TO7 = 0, ADC_FILLING_BUF_8TOF } ADC_RESULT_BUF_STATUS;
+
+typedef enum
+{
+    ADC_REFERENCE_VDD_TO_AVSS = 0,
+    ADC_REFERENCE_VREFPLUS_TO_AVSS,
+    ADC_REFERENCE_AVDD_TO_VREF_NEG,
+    ADC_REFERENCE_VREFPLUS_TO_VREFNEG
+} ADC_VOLTAGE_REFERENCE;
+
+typedef enum
+{
+    ADC_SAMPLING_MODE_MUXA = 0,
+    ADC_SAMPLING_MODE_ALTERNATE_INPUT
+} ADC_SAMPLING_MODE;
+
+typedef enum
+{
+    ADC_1SAMPLE_PER_INTERRUPT = 0, ADC_2SAMPLES_PER_INTERRUPT,
+    ADC_3SAMPLES_PER_INTERRUPT, ADC_4SAMPLES_PER_INTERRUPT,
+    ADC_5SAMPLES_PER_INTERRUPT, ADC_6SAMPLES_PER_INTERRUPT,
+    ADC_7SAMPLES_PER_INTERRUPT, ADC_8SAMPLES_PER_INTERRUPT,
+    ADC_9SAMPLES_PER_INTERRUPT, ADC_10SAMPLES_PER_INTERRUPT,
+    ADC_11SAMPLES_PER_INTERRUPT, ADC_12SAMPLES_PER_INTERRUPT,
+    ADC_13SAMPLES_PER_INTERRUPT, ADC_14SAMPLES_PER_INTERRUPT,
+    ADC_15SAMPLES_PER_INTERRUPT, ADC_16SAMPLES_PER_INTERRUPT
+} ADC_SAMPLES_PER_INTERRUPT;
+
+typedef enum
+{
+    ADC_INPUT_POSITIVE_AN0 = 0, ADC_INPUT_POSITIVE_AN1, ADC_INPUT_POSITIVE_AN2,
+    ADC_INPUT_POSITIVE_AN3, ADC_INPUT_POSITIVE_AN4, ADC_INPUT_POSITIVE_AN5,
+    ADC_INPUT_POSITIVE_AN6, ADC_INPUT_POSITIVE_AN7, ADC_INPUT_POSITIVE_AN8,
+    ADC_INPUT_POSITIVE_AN9, ADC_INPUT_POSITIVE_AN10, ADC_INPUT_POSITIVE_AN11,
+    ADC_INPUT_POSITIVE_AN12, ADC_INPUT_POSITIVE_AN13, ADC_INPUT_POSITIVE_AN14,
+    ADC_INPUT_POSITIVE_AN15
+} ADC_INPUTS_POSITIVE;
+
+typedef enum
+{
+    ADC_INPUT_NEGATIVE_VREF_MINUS = 0,
+    ADC_INPUT_NEGATIVE_AN1
+} ADC_INPUTS_NEGATIVE;
+
+typedef enum
+{
+    ADC_INPUT_SCAN_AN0 = 0x1, ADC_INPUT_SCAN_AN1 = 0x2, ADC_INPUT_SCAN_AN2 = 0x4,
+    ADC_INPUT_SCAN_AN3 = 0x8, ADC_INPUT_SCAN_AN4 = 0x10, ADC_INPUT_SCAN_AN5 = 0x20,
+    ADC_INPUT_SCAN_AN6 = 0x40, ADC_INPUT_SCAN_AN7 = 0x80, ADC_INPUT_SCAN_AN8 = 0x100,
+    ADC_INPUT_SCAN_AN9 = 0x200, ADC_INPUT_SCAN_AN10 = 0x400, ADC_INPUT_SCAN_AN11 = 0x800,
+    ADC_INPUT_SCAN_AN12 = 0x1000, ADC_INPUT_SCAN_AN13 = 0x2000,
+    ADC_INPUT_SCAN_AN14 = 0x4000, ADC_INPUT_SCAN_AN15 = 0x8000
+} ADC_INPUTS_SCAN;
+
+typedef enum
+{
+    ADC_CLOCK_SOURCE_PERIPHERAL_BUS_CLOCK = 0,
+    ADC_CLOCK_SOURCE_INTERNAL_RC
+} ADC_CLOCK_SOURCE;
+
+typedef enum
+{
+    ADC_CONVERSION_TRIGGER_SAMP_CLEAR = 0,
+    ADC_CONVERSION_TRIGGER_INT0_TRANSITION = 1,
+    ADC_CONVERSION_TRIGGER_TMR3_COMPARE_MATCH = 2,
+    ADC_CONVERSION_TRIGGER_CTMU_EVENT = 3,
+    ADC_CONVERSION_TRIGGER_INTERNAL_COUNT = 7
+} ADC_CONVERSION_TRIGGER_SOURCE;
+
+typedef enum
+{
+    ADC_RESULT_FORMAT_INTEGER_16BIT = 0,
+    ADC_RESULT_FORMAT_SIGNED_INTEGER_16BIT,
+    ADC_RESULT_FORMAT_FRACTIONAL_16BIT,
+    ADC_RESULT_FORMAT_SIGNED_FRACTIONAL_16BIT,
+    ADC_RESULT_FORMAT_INTEGER_32BIT,
+    ADC_RESULT_FORMAT_SIGNED_INTEGER_32BIT,
+    ADC_RESULT_FORMAT_FRACTIONAL_32BIT,
+    ADC_RESULT_FORMAT_SIGNED_FRACTIONAL_32BIT
+} ADC_RESULT_FORMAT;
+
+typedef enum
+{
+    ADC_BUFFER_MODE_ONE_16WORD_BUFFER = 0,
+    ADC_BUFFER_MODE_TWO_8WORD_BUFFERS
+} ADC_BUFFER_MODE;
+
+void PLIB_ADC_Enable(ADC_MODULE_ID index);
+void PLIB_ADC_Disable(ADC_MODULE_ID index);
+void PLIB_ADC_ConversionClockSourceSelect(ADC_MODULE_ID index, ADC_CLOCK_SOURCE source);
+void PLIB_ADC_ConversionClockSet(ADC_MODULE_ID index, uint32_t clockFrequency, uint32_t adcClock);
+void PLIB_ADC_StopInIdleDisable(ADC_MODULE_ID index);
+void PLIB_ADC_VoltageReferenceSelect(ADC_MODULE_ID index, ADC_VOLTAGE_REFERENCE config);
+void PLIB_ADC_SamplingModeSelect(ADC_MODULE_ID index, ADC_SAMPLING_MODE mode);
+void PLIB_ADC_SamplesPerInterruptSelect(ADC_MODULE_ID index, ADC_SAMPLES_PER_INTERRUPT value);
+void PLIB_ADC_ConversionTriggerSourceSelect(ADC_MODULE_ID index, ADC_CONVERSION_TRIGGER_SOURCE source);
+void PLIB_ADC_ResultFormatSelect(ADC_MODULE_ID index, ADC_RESULT_FORMAT format);
+void PLIB_ADC_ResultBufferModeSelect(ADC_MODULE_ID index, ADC_BUFFER_MODE mode);
+ADC_RESULT_BUF_STATUS PLIB_ADC_ResultBufferStatusGet(ADC_MODULE_ID index);
+void PLIB_ADC_SampleAutoStartEnable(ADC_MODULE_ID index);
+void PLIB_ADC_SampleAutoStartDisable(ADC_MODULE_ID index);
+void PLIB_ADC_SampleAcquisitionTimeSet(ADC_MODULE_ID index, uint8_t acqTime);
+void PLIB_ADC_MuxChannel0InputScanEnable(ADC_MODULE_ID index);
+void PLIB_ADC_MuxChannel0InputScanDisable(ADC_MODULE_ID index);
+void PLIB_ADC_MuxChannel0InputNegativeSelect(ADC_MODULE_ID index, ADC_MUX mux, ADC_INPUTS_NEGATIVE input);
+void PLIB_ADC_MuxChannel0InputPositiveSelect(ADC_MODULE_ID index, ADC_MUX mux, ADC_INPUTS_POSITIVE input);
+void PLIB_ADC_InputScanMaskAdd(ADC_MODULE_ID index, ADC_INPUTS_SCAN scanInputs);
+void PLIB_ADC_InputScanMaskRemove(ADC_MODULE_ID index, ADC_INPUTS_SCAN scanInputs);
+void PLIB_ADC_SamplingStart(ADC_MODULE_ID index);
+void PLIB_ADC_SamplingStop(ADC_MODULE_ID index);
+ADC_SAMPLE PLIB_ADC_ResultGetByIndex(ADC_MODULE_ID index, uint8_t bufferIndex);
+bool PLIB_ADC_ConversionHasCompleted(ADC_MODULE_ID index);
+
+// *****************************************************************************
+// Section: PLIB_I2C / PLIB_OSC
+// *****************************************************************************
+
+typedef enum { I2C_ID_1 = 0, I2C_ID_2, I2C_NUMBER_OF_MODULES } I2C_MODULE_ID;
+
+extern volatile uint32_t I2C2CON;
+extern volatile uint32_t I2C2BRG;
+
+void PLIB_I2C_Enable(I2C_MODULE_ID index);
+void PLIB_I2C_Disable(I2C_MODULE_ID index);
+void PLIB_I2C_HighFrequencyEnable(I2C_MODULE_ID index);
+void PLIB_I2C_HighFrequencyDisable(I2C_MODULE_ID index);
+void PLIB_I2C_BaudRateSet(I2C_MODULE_ID index, uint32_t clockFrequency, uint32_t baudRate);
+void PLIB_I2C_StopInIdleDisable(I2C_MODULE_ID index);
+void PLIB_I2C_SlaveClockStretchingEnable(I2C_MODULE_ID index);
+void PLIB_I2C_SlaveClockRelease(I2C_MODULE_ID index);
+bool PLIB_I2C_BusIsIdle(I2C_MODULE_ID index);
+void PLIB_I2C_MasterStart(I2C_MODULE_ID index);
+void PLIB_I2C_MasterStartRepeat(I2C_MODULE_ID index);
+void PLIB_I2C_MasterStop(I2C_MODULE_ID index);
+bool PLIB_I2C_StartWasDetected(I2C_MODULE_ID index);
+bool PLIB_I2C_StopWasDetected(I2C_MODULE_ID index);
+bool PLIB_I2C_ArbitrationLossHasOccurred(I2C_MODULE_ID index);
+void PLIB_I2C_ArbitrationLossClear(I2C_MODULE_ID index);
+bool PLIB_I2C_ReceiverOverflowHasOccurred(I2C_MODULE_ID index);
+void PLIB_I2C_ReceiverOverflowClear(I2C_MODULE_ID index);
+bool PLIB_I2C_TransmitterOverflowHasOccurred(I2C_MODULE_ID index);
+void PLIB_I2C_TransmitterOverflowClear(I2C_MODULE_ID index);
+bool PLIB_I2C_TransmitterIsReady(I2C_MODULE_ID index);
+bool PLIB_I2C_TransmitterIsBusy(I2C_MODULE_ID index);
+void PLIB_I2C_TransmitterByteSend(I2C_MODULE_ID index, uint8_t data);
+bool PLIB_I2C_TransmitterByteHasCompleted(I2C_MODULE_ID index);
+bool PLIB_I2C_TransmitterByteWasAcknowledged(I2C_MODULE_ID index);
+void PLIB_I2C_MasterReceiverClock1Byte(I2C_MODULE_ID index);
+bool PLIB_I2C_ReceivedByteIsAvailable(I2C_MODULE_ID index);
+uint8_t PLIB_I2C_ReceivedByteGet(I2C_MODULE_ID index);
+bool PLIB_I2C_MasterReceiverReadyToAcknowledge(I2C_MODULE_ID index);
+void PLIB_I2C_ReceivedByteAcknowledge(I2C_MODULE_ID index, bool ack);
+bool PLIB_I2C_ReceiverByteAcknowledgeHasCompleted(I2C_MODULE_ID index);
+bool PLIB_I2C_SlaveReadIsRequested(I2C_MODULE_ID index);
+bool PLIB_I2C_SlaveAddressIsDetected(I2C_MODULE_ID index);
+bool PLIB_I2C_SlaveDataIsDetected(I2C_MODULE_ID index);
+void PLIB_I2C_SlaveClockHold(I2C_MODULE_ID index);
+
+// *****************************************************************************
+// Section: PLIB_USART (émission seule)
+// *****************************************************************************
+
+typedef enum { USART_ID_1 = 0, USART_ID_2, USART_NUMBER_OF_MODULES } USART_MODULE_ID;
+
+typedef enum
+{
+    USART_8N1 = 0x00,
+    USART_8E1 = 0x02,
+    USART_8O1 = 0x04,
+    USART_9N1 = 0x06,
+    USART_8N2 = 0x01
+} USART_LINECONTROL_MODE;
+
+typedef enum
+{
+    USART_TRANSMIT_FIFO_NOT_FULL = 0,
+    USART_TRANSMIT_FIFO_IDLE,
+    USART_TRANSMIT_FIFO_EMPTY
+} USART_TRANSMIT_INTR_MODE;
+
+void PLIB_USART_Enable(USART_MODULE_ID index);
+void PLIB_USART_Disable(USART_MODULE_ID index);
+void PLIB_USART_BaudRateHighEnable(USART_MODULE_ID index);
+void PLIB_USART_BaudRateSet(USART_MODULE_ID index, uint32_t clockFrequency, uint32_t baudRate);
+void PLIB_USART_LineControlModeSelect(USART_MODULE_ID index, USART_LINECONTROL_MODE dataFlowConfig);
+void PLIB_USART_TransmitterEnable(USART_MODULE_ID index);
+void PLIB_USART_TransmitterDisable(USART_MODULE_ID index);
+void PLIB_USART_TransmitterInterruptModeSelect(USART_MODULE_ID index, USART_TRANSMIT_INTR_MODE fifolevel);
+void *PLIB_USART_TransmitterAddressGet(USART_MODULE_ID index);
+
+// *****************************************************************************
+// Section: PLIB_DMA
+// *****************************************************************************
+
+// Adresses : pointeurs hôte (KVA_TO_PA de mock/sys/kmem.h est l'identité)
+typedef enum { DMA_ID_0 = 0, DMA_NUMBER_OF_MODULES } DMA_MODULE_ID;
+
+typedef enum
+{
+    DMA_CHANNEL_0 = 0, DMA_CHANNEL_1, DMA_CHANNEL_2, DMA_CHANNEL_3,
+    DMA_NUMBER_OF_CHANNELS
+} DMA_CHANNEL;
+
+typedef enum
+{
+    DMA_CHANNEL_PRIORITY_0 = 0, DMA_CHANNEL_PRIORITY_1,
+    DMA_CHANNEL_PRIORITY_2, DMA_CHANNEL_PRIORITY_3
+} DMA_CHANNEL_PRIORITY;
+
+typedef enum
+{
+    DMA_CHANNEL_TRIGGER_TRANSFER_START = 0,
+    DMA_CHANNEL_TRIGGER_TRANSFER_ABORT,
+    DMA_CHANNEL_TRIGGER_PATTERN_MATCH_ABORT
+} DMA_CHANNEL_TRIGGER_TYPE;
+
+typedef enum
+{
+    DMA_TRIGGER_SOURCE_NONE = -1,
+    DMA_TRIGGER_USART_1_TRANSMIT = 38   // _UART1_TX_IRQ
+} DMA_TRIGGER_SOURCE;
+
+typedef enum
+{
+    DMA_INT_ADDRESS_ERROR = 0x01,
+    DMA_INT_TRANSFER_ABORT = 0x02,
+    DMA_INT_CELL_TRANSFER_COMPLETE = 0x04,
+    DMA_INT_BLOCK_TRANSFER_COMPLETE = 0x08,
+    DMA_INT_DESTINATION_HALF_FULL = 0x10,
+    DMA_INT_DESTINATION_DONE = 0x20,
+    DMA_INT_SOURCE_HALF_EMPTY = 0x40,
+    DMA_INT_SOURCE_DONE = 0x80
+} DMA_INT_TYPE;
+
+void PLIB_DMA_Enable(DMA_MODULE_ID index);
+void PLIB_DMA_Disable(DMA_MODULE_ID index);
+void PLIB_DMA_ChannelXEnable(DMA_MODULE_ID index, DMA_CHANNEL channel);
+void PLIB_DMA_ChannelXDisable(DMA_MODULE_ID index, DMA_CHANNEL channel);
+bool PLIB_DMA_ChannelXIsEnabled(DMA_MODULE_ID index, DMA_CHANNEL channel);
+void PLIB_DMA_ChannelXPrioritySelect(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_CHANNEL_PRIORITY channelPriority);
+void PLIB_DMA_ChannelXTriggerEnable(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_CHANNEL_TRIGGER_TYPE trigger);
+void PLIB_DMA_ChannelXStartIRQSet(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_TRIGGER_SOURCE IRQ);
+void PLIB_DMA_ChannelXSourceStartAddressSet(DMA_MODULE_ID index, DMA_CHANNEL channel, uintptr_t sourceStartAddress);
+void PLIB_DMA_ChannelXDestinationStartAddressSet(DMA_MODULE_ID index, DMA_CHANNEL channel, uintptr_t destinationStartAddress);
+void PLIB_DMA_ChannelXSourceSizeSet(DMA_MODULE_ID index, DMA_CHANNEL channel, uint16_t sourceSize);
+void PLIB_DMA_ChannelXDestinationSizeSet(DMA_MODULE_ID index, DMA_CHANNEL channel, uint16_t destinationSize);
+void PLIB_DMA_ChannelXCellSizeSet(DMA_MODULE_ID index, DMA_CHANNEL channel, uint16_t cellSize);
+bool PLIB_DMA_ChannelXINTSourceFlagGet(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_INT_TYPE dmaINTSource);
+void PLIB_DMA_ChannelXINTSourceFlagClear(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_INT_TYPE dmaINTSource);
+
+// *****************************************************************************
+// Section: DRV_I2C (types communs du driver, modèle buffer statique)
+// *****************************************************************************
+
+typedef uintptr_t DRV_I2C_BUFFER_HANDLE;
+#define DRV_I2C_BUFFER_HANDLE_INVALID   ((DRV_I2C_BUFFER_HANDLE)(-1))
+#define DRV_I2C_NUM_OF_BUFFER_OBJECTS   5
+
+typedef enum
+{
+    DRV_I2C_BUFFER_EVENT_PENDING,
+    DRV_I2C_BUFFER_EVENT_COMPLETE,
+    DRV_I2C_BUFFER_EVENT_ERROR,
+    DRV_I2C_SEND_STOP_EVENT,
+    DRV_I2C_SEND_RESTART_EVENT,
+    DRV_I2C_BUFFER_SLAVE_READ_REQUESTED,
+    DRV_I2C_BUFFER_SLAVE_WRITE_REQUESTED,
+    DRV_I2C_BUFFER_SLAVE_READ_BYTE,
+    DRV_I2C_BUFFER_SLAVE_WRITE_BYTE,
+    DRV_I2C_BUFFER_MASTER_ACK_SEND,
+    DRV_I2C_BUFFER_MASTER_NACK_SEND
+} DRV_I2C_BUFFER_EVENT;
+
+typedef enum
+{
+    DRV_I2C_HALT_ON_ERROR = 0x00,
+    DRV_I2C_BUS_IGNORE_COLLISION_ERROR = 0x01,
+    DRV_I2C_BUS_IGNORE_OVERFLOW_ERROR = 0x02
+} DRV_I2C_BUS_ERROR_EVENT;
+
+typedef enum { DRV_I2C_MODE_MASTER = 0, DRV_I2C_MODE_SLAVE } DRV_I2C_MODE;
+
+typedef enum
+{
+    DRV_I2C_OP_WRITE = 0x00,
+    DRV_I2C_OP_READ = 0x01,
+    DRV_I2C_OP_WRITE_READ = 0x02
+} DRV_I2C_OPERATIONS;
+
+typedef enum
+{
+    DRV_I2C_TASK_SEND_DEVICE_ADDRESS,
+    DRV_I2C_SEND_DEVICE_ADDRESS_BYTE_2,
+    DRV_I2C_SEND_RANDOM_READ_DEVICE_ADDRESS,
+    DRV_I2C_TASK_PROCESS_READ_ONLY,
+    DRV_I2C_TASK_PROCESS_WRITE_ONLY,
+    DRV_I2C_BUS_SILENT,
+    DRV_I2C_TASK_SET_RCEN_ONLY,
+    DRV_I2C_TASK_PROCESS_STOP
+} DRV_I2C_DATA_OBJECT_TASK;
+
+typedef void (*DRV_I2C_BUFFER_EVENT_HANDLER)(DRV_I2C_BUFFER_EVENT event,
+                                             DRV_I2C_BUFFER_HANDLE bufferHandle,
+                                             uintptr_t context);
+typedef void (*DRV_I2C_CallBack)(DRV_I2C_BUFFER_EVENT event, void *context);
+
+// *****************************************************************************
+// Section: Etat des périphériques simulés
+// *****************************************************************************
+
+#define HOST_TMR_NUM    5
+#define HOST_ADC_BUF    16
+
+// Séquence en cours sur le bus I2C (bit de commande de I2CxCON ou
+// émission de I2CxTRN), terminée par le simulateur (sim/host_i2c.c)
+typedef enum
+{
+    HOST_I2C_IDLE = 0,
+    HOST_I2C_START,             // SEN
+    HOST_I2C_RESTART,           // RSEN
+    HOST_I2C_STOP,              // PEN
+    HOST_I2C_TX,                // TRSTAT
+    HOST_I2C_RX,                // RCEN
+    HOST_I2C_ACK                // ACKEN
+} HOST_I2C_OP;
+
+typedef struct
+{
+    bool        running;
+    TMR_PRESCALE prescale;
+    uint16_t    period;
+    uint16_t    counter;
+} HOST_TMR;
+
+// Canal DMA : transfert de bloc démarré par un événement d'interruption
+typedef struct
+{
+    bool        enabled;        // CHEN
+    bool        startIrqEn;     // SIRQEN
+    DMA_TRIGGER_SOURCE startIrq; // CHSIRQ
+    uintptr_t   src;            // DCHxSSA
+    uintptr_t   dst;            // DCHxDSA
+    uint16_t    srcSize;
+    uint16_t    dstSize;
+    uint16_t    cellSize;
+    uint8_t     flags;          // DMA_INT_TYPE levés (DCHxINT)
+} HOST_DMA;
+
+typedef struct
+{
+    /* Interruptions */
+    bool        intGlobal;
+    bool        intEnabled[INT_SOURCE_NUM];
+    bool        intFlag[INT_SOURCE_NUM];
+    INT_PRIORITY_LEVEL intPriority[INT_VECTOR_NUM];
+
+    /* Ports : LAT (sorties), PORT (entrées), CNEN (change notification) */
+    uint16_t    lat[PORT_CHANNEL_NUM];
+    uint16_t    port[PORT_CHANNEL_NUM];
+    uint16_t    cnEnable[PORT_CHANNEL_NUM];
+
+    /* Timers */
+    HOST_TMR    tmr[HOST_TMR_NUM];
+
+    /* Output Compare 1 */
+    bool        ocEnabled;
+    OC_COMPARE_MODES ocMode;
+    OC_16BIT_TIMERS ocTimer;
+    uint16_t    ocR;            // OC1R  (front montant)
+    uint16_t    ocRS;           // OC1RS (largeur d'impulsion)
+    bool        ocFault;        // OCFLT : sortie forcée à zéro
+    bool        ocFaultPin;     // Entrée OCFA active (défaut présent)
+    bool        ocLow;          // Mode PWM réécrit : sortie à zéro
+                                // jusqu'à la fin de période
+
+    /* Comparateur 1 et CVREF */
+    bool        cmpEnabled;
+    bool        cmpInvert;
+    bool        cmpOut;         // C1OUT (après inversion)
+    CMP_NON_INVERTING_INPUT cmpNonInv;
+    CMP_INVERTING_INPUT cmpInv;
+    CMP_INTERRUPT_EVENT cmpEvent;
+    bool        cvrEnabled;
+    bool        cvrWide;        // CVRR
+    CMP_CVREF_VALUE cvrValue;
+
+    /* ADC */
+    bool        adcEnabled;
+    bool        adcSampling;
+    bool        adcDone;
+    bool        adcAutoSample;  // ASAM
+    bool        adcScan;        // CSCNA
+    ADC_BUFFER_MODE adcBufMode;
+    bool        adcFillHigh;    // BUFS : remplissage de ADC1BUF8..F
+    uint8_t     adcSeqPos;      // Rang de la prochaine conversion de la séquence
+    ADC_SAMPLING_MODE adcSamplingMode;
+    ADC_SAMPLES_PER_INTERRUPT adcSamplesPerInt;
+    ADC_CONVERSION_TRIGGER_SOURCE adcTrigger;
+    ADC_INPUTS_POSITIVE adcPosA;
+    ADC_INPUTS_POSITIVE adcPosB;
+    uint32_t    adcScanMask;
+    uint16_t    adcInput[16];   // Tension présente sur chaque ANx (codes)
+    ADC_SAMPLE  adcBuf[HOST_ADC_BUF];
+
+    /* I2C1 (maître) */
+    bool        i2cEnabled;
+    uint32_t    i2cBaud;
+    HOST_I2C_OP i2cOp;
+    uint8_t     i2cTrn;         // Octet en émission
+    uint8_t     i2cRcv;         // I2CxRCV
+    bool        i2cRbf;         // RBF : octet reçu non lu
+    bool        i2cNack;        // ACKSTAT : dernier octet non acquitté
+    bool        i2cAckDt;       // ACKDT : NACK à émettre
+    bool        i2cStart;       // S : start détecté en dernier
+    bool        i2cStop;        // P : stop détecté en dernier
+    void        (*i2cPoll)(void); // Appelé à chaque lecture d'état (attente active)
+
+    /* UART1 (émission) et DMA */
+    bool        uartEnabled;
+    bool        uartTxEnabled;
+    bool        uartBrgh;
+    uint16_t    uartBrg;        // U1BRG
+    uint32_t    uartTxReg;      // U1TXREG (destination du DMA)
+    bool        dmaEnabled;     // DMACON.ON
+    HOST_DMA    dma[DMA_NUMBER_OF_CHANNELS];
+} HOST_PLIB_STATE;
+
+extern HOST_PLIB_STATE hostPlib;
+
+void HOST_PlibReset(void);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+// DOM-IGNORE-END
+
+#endif
@@ -0,0 +1,1042 @@
+//--------------------------------------------------------
+//      plib_mock.c
+//--------------------------------------------------------
+//	Description :	Implémentation hôte des appels PLIB / services
+//                  système utilisés par le firmware.
+//                  Chaque fonction agit sur hostPlib (registres simulés).
+//--------------------------------------------------------
+
+#include <string.h>
+#include <time.h>
+#include "host_plib.h"
+#include "system_config.h"
+
+HOST_PLIB_STATE hostPlib;
+
+volatile uint32_t I2C2CON;
+volatile uint32_t I2C2BRG;
+
+void HOST_PlibReset(void)
+{
+    memset(&hostPlib, 0, sizeof(hostPlib));
+    I2C2CON = 0;
+    I2C2BRG = 0;
+}
+
+// *****************************************************************************
+// Section: Compilateur XC32
+// *****************************************************************************
+
+uint32_t _CP0_GET_COUNT(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * (SYS_CLK_FREQ / 2)
+                      + (uint64_t)ts.tv_nsec * (SYS_CLK_FREQ / 2000000ul) / 1000u);
+}
+
+// *****************************************************************************
+// Section: Services système
+// *****************************************************************************
+
+void SYS_CLK_Initialize(const SYS_CLK_INIT *clkInit)
+{
+    (void)clkInit;
+}
+
+uint32_t SYS_CLK_SystemFrequencyGet(void)
+{
+    return SYS_CLK_FREQ;
+}
+
+uint32_t SYS_CLK_PeripheralFrequencyGet(CLK_BUSES_PERIPHERAL peripheralBus)
+{
+    (void)peripheralBus;
+    return SYS_CLK_BUS_PERIPHERAL_1;
+}
+
+SYS_MODULE_OBJ SYS_DEVCON_Initialize(const SYS_MODULE_INDEX index, const SYS_MODULE_INIT * const init)
+{
+    (void)index;
+    (void)init;
+    return (SYS_MODULE_OBJ)0;
+}
+
+void SYS_DEVCON_PerformanceConfig(unsigned int sysclk)
+{
+    (void)sysclk;
+}
+
+void SYS_DEVCON_JTAGEnable(void)
+{
+}
+
+void SYS_DEVCON_JTAGDisable(void)
+{
+}
+
+void SYS_PORTS_Initialize(void)
+{
+    hostPlib.lat[PORT_CHANNEL_A] = SYS_PORT_A_LAT;
+    hostPlib.lat[PORT_CHANNEL_B] = SYS_PORT_B_LAT;
+    hostPlib.port[PORT_CHANNEL_A] |= SYS_PORT_A_CNPU;   // Pull-ups : repos haut
+    hostPlib.port[PORT_CHANNEL_B] |= SYS_PORT_B_CNPU;
+    hostPlib.cnEnable[PORT_CHANNEL_A] = SYS_PORT_A_CNEN;
+    hostPlib.cnEnable[PORT_CHANNEL_B] = SYS_PORT_B_CNEN;
+    PLIB_INT_VectorPrioritySet(INT_ID_0, INT_VECTOR_CN, INT_PRIORITY_LEVEL1);
+    PLIB_INT_SourceFlagClear(INT_ID_0, INT_SOURCE_CHANGE_NOTICE_B);
+    PLIB_INT_SourceEnable(INT_ID_0, INT_SOURCE_CHANGE_NOTICE_B);
+}
+
+void SYS_INT_Initialize(void)
+{
+    hostPlib.intGlobal = false;
+}
+
+void SYS_INT_Enable(void)
+{
+    hostPlib.intGlobal = true;
+}
+
+bool SYS_INT_Disable(void)
+{
+    bool state = hostPlib.intGlobal;
+    hostPlib.intGlobal = false;
+    return state;
+}
+
+void SYS_INT_Restore(bool state)
+{
+    hostPlib.intGlobal = state;
+}
+
+bool SYS_INT_SourceDisable(INT_SOURCE source)
+{
+    bool state = hostPlib.intEnabled[source];
+    hostPlib.intEnabled[source] = false;
+    return state;
+}
+
+void SYS_INT_SourceRestore(INT_SOURCE source, bool status)
+{
+    if (status)
+        hostPlib.intEnabled[source] = true;
+}
+
+// *****************************************************************************
+// Section: PLIB_INT
+// *****************************************************************************
+
+void PLIB_INT_Enable(INT_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.intGlobal = true;
+}
+
+void PLIB_INT_Disable(INT_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.intGlobal = false;
+}
+
+void PLIB_INT_SourceEnable(INT_MODULE_ID index, INT_SOURCE source)
+{
+    (void)index;
+    hostPlib.intEnabled[source] = true;
+}
+
+void PLIB_INT_SourceDisable(INT_MODULE_ID index, INT_SOURCE source)
+{
+    (void)index;
+    hostPlib.intEnabled[source] = false;
+}
+
+bool PLIB_INT_SourceIsEnabled(INT_MODULE_ID index, INT_SOURCE source)
+{
+    (void)index;
+    return hostPlib.intEnabled[source];
+}
+
+void PLIB_INT_SourceFlagSet(INT_MODULE_ID index, INT_SOURCE source)
+{
+    (void)index;
+    hostPlib.intFlag[source] = true;
+}
+
+void PLIB_INT_SourceFlagClear(INT_MODULE_ID index, INT_SOURCE source)
+{
+    (void)index;
+    hostPlib.intFlag[source] = false;
+}
+
+bool PLIB_INT_SourceFlagGet(INT_MODULE_ID index, INT_SOURCE source)
+{
+    (void)index;
+    return hostPlib.intFlag[source];
+}
+
+void PLIB_INT_VectorPrioritySet(INT_MODULE_ID index, INT_VECTOR vector, INT_PRIORITY_LEVEL priority)
+{
+    (void)index;
+    hostPlib.intPriority[vector] = priority;
+}
+
+void PLIB_INT_VectorSubPrioritySet(INT_MODULE_ID index, INT_VECTOR vector, INT_SUBPRIORITY_LEVEL subPriority)
+{
+    (void)index;
+    (void)vector;
+    (void)subPriority;
+}
+
+// *****************************************************************************
+// Section: PLIB_PORTS
+// *****************************************************************************
+
+void PLIB_PORTS_PinSet(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos)
+{
+    (void)index;
+    hostPlib.lat[channel] |= (uint16_t)(1u << bitPos);
+}
+
+void PLIB_PORTS_PinClear(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos)
+{
+    (void)index;
+    hostPlib.lat[channel] &= (uint16_t)~(1u << bitPos);
+}
+
+void PLIB_PORTS_PinToggle(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos)
+{
+    (void)index;
+    hostPlib.lat[channel] ^= (uint16_t)(1u << bitPos);
+}
+
+void PLIB_PORTS_PinWrite(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos, bool value)
+{
+    if (value)
+        PLIB_PORTS_PinSet(index, channel, bitPos);
+    else
+        PLIB_PORTS_PinClear(index, channel, bitPos);
+}
+
+// Direction non modélisée : PORT reste l'entrée imposée par le simulateur
+void PLIB_PORTS_PinDirectionOutputSet(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos)
+{
+    (void)index; (void)channel; (void)bitPos;
+}
+
+void PLIB_PORTS_PinDirectionInputSet(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos)
+{
+    (void)index; (void)channel; (void)bitPos;
+}
+
+bool PLIB_PORTS_PinGet(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos)
+{
+    (void)index;
+    return (hostPlib.port[channel] >> bitPos) & 1u;
+}
+
+bool PLIB_PORTS_PinGetLatched(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos)
+{
+    (void)index;
+    return (hostPlib.lat[channel] >> bitPos) & 1u;
+}
+
+// *****************************************************************************
+// Section: PLIB_TMR
+// *****************************************************************************
+
+void PLIB_TMR_Start(TMR_MODULE_ID index)
+{
+    hostPlib.tmr[index].running = true;
+}
+
+void PLIB_TMR_Stop(TMR_MODULE_ID index)
+{
+    hostPlib.tmr[index].running = false;
+}
+
+void PLIB_TMR_ClockSourceSelect(TMR_MODULE_ID index, TMR_CLOCK_SOURCE source)
+{
+    (void)index;
+    (void)source;
+}
+
+void PLIB_TMR_ClockSourceExternalSyncEnable(TMR_MODULE_ID index)
+{
+    (void)index;
+}
+
+void PLIB_TMR_ClockSourceExternalSyncDisable(TMR_MODULE_ID index)
+{
+    (void)index;
+}
+
+void PLIB_TMR_PrescaleSelect(TMR_MODULE_ID index, TMR_PRESCALE prescale)
+{
+    hostPlib.tmr[index].prescale = prescale;
+}
+
+uint16_t PLIB_TMR_PrescaleGet(TMR_MODULE_ID index)
+{
+    static const uint16_t divisor[] = { 1, 2, 4, 8, 16, 32, 64, 256 };
+    return divisor[hostPlib.tmr[index].prescale];
+}
+
+void PLIB_TMR_Mode16BitEnable(TMR_MODULE_ID index)
+{
+    (void)index;
+}
+
+void PLIB_TMR_Counter16BitSet(TMR_MODULE_ID index, uint16_t value)
+{
+    hostPlib.tmr[index].counter = value;
+}
+
+uint16_t PLIB_TMR_Counter16BitGet(TMR_MODULE_ID index)
+{
+    return hostPlib.tmr[index].counter;
+}
+
+void PLIB_TMR_Counter16BitClear(TMR_MODULE_ID index)
+{
+    hostPlib.tmr[index].counter = 0;
+}
+
+void PLIB_TMR_Period16BitSet(TMR_MODULE_ID index, uint16_t period)
+{
+    hostPlib.tmr[index].period = period;
+}
+
+uint16_t PLIB_TMR_Period16BitGet(TMR_MODULE_ID index)
+{
+    return hostPlib.tmr[index].period;
+}
+
+void PLIB_TMR_StopInIdleDisable(TMR_MODULE_ID index)
+{
+    (void)index;
+}
+
+bool PLIB_TMR_ExistsClockSource(TMR_MODULE_ID index)
+{
+    (void)index;
+    return true;
+}
+
+bool PLIB_TMR_ExistsClockSourceSync(TMR_MODULE_ID index)
+{
+    return (index == TMR_ID_1);
+}
+
+bool PLIB_TMR_ExistsPrescale(TMR_MODULE_ID index)
+{
+    (void)index;
+    return true;
+}
+
+// *****************************************************************************
+// Section: PLIB_OC
+// *****************************************************************************
+
+void PLIB_OC_Enable(OC_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.ocEnabled = true;
+}
+
+void PLIB_OC_Disable(OC_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.ocEnabled = false;
+}
+
+void PLIB_OC_ModeSelect(OC_MODULE_ID index, OC_COMPARE_MODES cmpMode)
+{
+    (void)index;
+    hostPlib.ocMode = cmpMode;
+    // Entrée en mode PWM : sortie à zéro jusqu'au début de période
+    hostPlib.ocLow = (cmpMode >= OC_COMPARE_PWM_MODE_WITHOUT_FAULT_PROTECTION);
+    // Réécriture du mode : OCFLT effacé si OCFA est au repos, sinon le
+    // défaut est détecté de nouveau
+    hostPlib.ocFault = (cmpMode == OC_COMPARE_PWM_MODE_WITH_FAULT_PROTECTION)
+                       && hostPlib.ocFaultPin;
+    if (hostPlib.ocFault)
+        hostPlib.intFlag[INT_SOURCE_OUTPUT_COMPARE_1] = true;
+}
+
+void PLIB_OC_BufferSizeSelect(OC_MODULE_ID index, OC_BUFFER_SIZE size)
+{
+    (void)index;
+    (void)size;
+}
+
+void PLIB_OC_TimerSelect(OC_MODULE_ID index, OC_16BIT_TIMERS tmr)
+{
+    (void)index;
+    hostPlib.ocTimer = tmr;
+}
+
+void PLIB_OC_Buffer16BitSet(OC_MODULE_ID index, uint16_t value)
+{
+    (void)index;
+    hostPlib.ocR = value;
+}
+
+void PLIB_OC_PulseWidth16BitSet(OC_MODULE_ID index, uint16_t pulseWidth)
+{
+    (void)index;
+    hostPlib.ocRS = pulseWidth;
+}
+
+bool PLIB_OC_FaultHasOccurred(OC_MODULE_ID index)
+{
+    (void)index;
+    return hostPlib.ocFault;
+}
+
+// *****************************************************************************
+// Section: PLIB_CMP (comparateur 1 seul)
+// *****************************************************************************
+
+void PLIB_CMP_Enable(CMP_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.cmpEnabled = true;
+}
+
+void PLIB_CMP_Disable(CMP_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.cmpEnabled = false;
+}
+
+void PLIB_CMP_NonInvertingInputSelect(CMP_MODULE_ID index, CMP_NON_INVERTING_INPUT input)
+{
+    (void)index;
+    hostPlib.cmpNonInv = input;
+}
+
+void PLIB_CMP_InvertingInputSelect(CMP_MODULE_ID index, CMP_INVERTING_INPUT input)
+{
+    (void)index;
+    hostPlib.cmpInv = input;
+}
+
+void PLIB_CMP_OutputInvertEnable(CMP_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.cmpInvert = true;
+}
+
+void PLIB_CMP_OutputInvertDisable(CMP_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.cmpInvert = false;
+}
+
+void PLIB_CMP_InterruptEventSelect(CMP_MODULE_ID index, CMP_INTERRUPT_EVENT event)
+{
+    (void)index;
+    hostPlib.cmpEvent = event;
+}
+
+bool PLIB_CMP_OutputStatusGet(CMP_MODULE_ID index)
+{
+    (void)index;
+    return hostPlib.cmpOut;
+}
+
+void PLIB_CMP_CVREF_Enable(CMP_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.cvrEnabled = true;
+}
+
+void PLIB_CMP_CVREF_Disable(CMP_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.cvrEnabled = false;
+}
+
+void PLIB_CMP_CVREF_SourceVoltageSelect(CMP_MODULE_ID index, CMP_CVREF_VOLTAGE_SOURCE source)
+{
+    (void)index;
+    (void)source;
+}
+
+void PLIB_CMP_CVREF_WideRangeEnable(CMP_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.cvrWide = true;
+}
+
+void PLIB_CMP_CVREF_WideRangeDisable(CMP_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.cvrWide = false;
+}
+
+void PLIB_CMP_CVREF_ValueSelect(CMP_MODULE_ID index, CMP_CVREF_VALUE value)
+{
+    (void)index;
+    hostPlib.cvrValue = value;
+}
+
+// *****************************************************************************
+// Section: PLIB_ADC
+// *****************************************************************************
+
+void PLIB_ADC_Enable(ADC_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.adcEnabled = true;
+    hostPlib.adcSeqPos = 0;
+    hostPlib.adcFillHigh = false;
+}
+
+void PLIB_ADC_Disable(ADC_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.adcEnabled = false;
+}
+
+void PLIB_ADC_ConversionClockSourceSelect(ADC_MODULE_ID index, ADC_CLOCK_SOURCE source)
+{
+    (void)index;
+    (void)source;
+}
+
+void PLIB_ADC_ConversionClockSet(ADC_MODULE_ID index, uint32_t clockFrequency, uint32_t adcClock)
+{
+    (void)index;
+    (void)clockFrequency;
+    (void)adcClock;
+}
+
+void PLIB_ADC_StopInIdleDisable(ADC_MODULE_ID index)
+{
+    (void)index;
+}
+
+void PLIB_ADC_VoltageReferenceSelect(ADC_MODULE_ID index, ADC_VOLTAGE_REFERENCE config)
+{
+    (void)index;
+    (void)config;
+}
+
+void PLIB_ADC_SamplingModeSelect(ADC_MODULE_ID index, ADC_SAMPLING_MODE mode)
+{
+    (void)index;
+    hostPlib.adcSamplingMode = mode;
+}
+
+void PLIB_ADC_SamplesPerInterruptSelect(ADC_MODULE_ID index, ADC_SAMPLES_PER_INTERRUPT value)
+{
+    (void)index;
+    hostPlib.adcSamplesPerInt = value;
+}
+
+void PLIB_ADC_ConversionTriggerSourceSelect(ADC_MODULE_ID index, ADC_CONVERSION_TRIGGER_SOURCE source)
+{
+    (void)index;
+    hostPlib.adcTrigger = source;
+}
+
+void PLIB_ADC_ResultFormatSelect(ADC_MODULE_ID index, ADC_RESULT_FORMAT format)
+{
+    (void)index;
+    (void)format;
+}
+
+void PLIB_ADC_ResultBufferModeSelect(ADC_MODULE_ID index, ADC_BUFFER_MODE mode)
+{
+    (void)index;
+    hostPlib.adcBufMode = mode;
+    hostPlib.adcFillHigh = false;
+}
+
+ADC_RESULT_BUF_STATUS PLIB_ADC_ResultBufferStatusGet(ADC_MODULE_ID index)
+{
+    (void)index;
+    return hostPlib.adcFillHigh ? ADC_FILLING_BUF_8TOF : ADC_FILLING_BUF_0TO7;
+}
+
+void PLIB_ADC_SampleAutoStartEnable(ADC_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.adcAutoSample = true;
+}
+
+void PLIB_ADC_SampleAutoStartDisable(ADC_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.adcAutoSample = false;
+}
+
+void PLIB_ADC_SampleAcquisitionTimeSet(ADC_MODULE_ID index, uint8_t acqTime)
+{
+    (void)index;
+    (void)acqTime;
+}
+
+void PLIB_ADC_MuxChannel0InputScanEnable(ADC_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.adcScan = true;
+}
+
+void PLIB_ADC_MuxChannel0InputScanDisable(ADC_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.adcScan = false;
+}
+
+void PLIB_ADC_MuxChannel0InputNegativeSelect(ADC_MODULE_ID index, ADC_MUX mux, ADC_INPUTS_NEGATIVE input)
+{
+    (void)index;
+    (void)mux;
+    (void)input;
+}
+
+void PLIB_ADC_MuxChannel0InputPositiveSelect(ADC_MODULE_ID index, ADC_MUX mux, ADC_INPUTS_POSITIVE input)
+{
+    (void)index;
+    if (mux == ADC_MUX_A)
+        hostPlib.adcPosA = input;
+    else
+        hostPlib.adcPosB = input;
+}
+
+void PLIB_ADC_InputScanMaskAdd(ADC_MODULE_ID index, ADC_INPUTS_SCAN scanInputs)
+{
+    (void)index;
+    hostPlib.adcScanMask |= (uint32_t)scanInputs;
+}
+
+void PLIB_ADC_InputScanMaskRemove(ADC_MODULE_ID index, ADC_INPUTS_SCAN scanInputs)
+{
+    (void)index;
+    hostPlib.adcScanMask &= ~(uint32_t)scanInputs;
+}
+
+void PLIB_ADC_SamplingStart(ADC_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.adcSampling = true;
+}
+
+void PLIB_ADC_SamplingStop(ADC_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.adcSampling = false;
+}
+
+ADC_SAMPLE PLIB_ADC_ResultGetByIndex(ADC_MODULE_ID index, uint8_t bufferIndex)
+{
+    (void)index;
+    return hostPlib.adcBuf[bufferIndex & (HOST_ADC_BUF - 1)];
+}
+
+bool PLIB_ADC_ConversionHasCompleted(ADC_MODULE_ID index)
+{
+    (void)index;
+    return hostPlib.adcDone;
+}
+
+// *****************************************************************************
+// Section: PLIB_I2C
+// Maître I2C1 : chaque commande (start, stop, émission, réception,
+// acquittement) occupe le bus jusqu'à ce que le simulateur la termine
+// (sim/host_i2c.c), qui lève alors l'interruption maître comme sur cible.
+// Les fonctions esclave ne sont pas modélisées.
+// *****************************************************************************
+
+static void _I2cCommand(HOST_I2C_OP op)
+{
+    if (hostPlib.i2cEnabled)
+        hostPlib.i2cOp = op;
+}
+
+// Etat lu en boucle par les fonctions bloquantes (Mc32_I2cUtilCCS.c) :
+// hostPlib.i2cPoll, si posé, fait avancer la simulation pendant l'attente
+static void _I2cPoll(void)
+{
+    if (hostPlib.i2cPoll != NULL)
+        hostPlib.i2cPoll();
+}
+
+void PLIB_I2C_Enable(I2C_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.i2cEnabled = true;
+}
+
+// ON = 0 : module remis à zéro (I2CxSTAT effacé), séquence abandonnée
+void PLIB_I2C_Disable(I2C_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.i2cEnabled = false;
+    hostPlib.i2cOp = HOST_I2C_IDLE;
+    hostPlib.i2cStart = false;
+    hostPlib.i2cStop = false;
+    hostPlib.i2cRbf = false;
+    hostPlib.i2cNack = false;
+}
+
+void PLIB_I2C_HighFrequencyEnable(I2C_MODULE_ID index)
+{
+    (void)index;
+}
+
+void PLIB_I2C_HighFrequencyDisable(I2C_MODULE_ID index)
+{
+    (void)index;
+}
+
+void PLIB_I2C_BaudRateSet(I2C_MODULE_ID index, uint32_t clockFrequency, uint32_t baudRate)
+{
+    (void)index;
+    hostPlib.i2cBaud = baudRate;
+    I2C2BRG = clockFrequency / (2 * baudRate) - 2;
+}
+
+void PLIB_I2C_StopInIdleDisable(I2C_MODULE_ID index)
+{
+    (void)index;
+}
+
+void PLIB_I2C_SlaveClockStretchingEnable(I2C_MODULE_ID index)
+{
+    (void)index;
+}
+
+void PLIB_I2C_SlaveClockRelease(I2C_MODULE_ID index)
+{
+    (void)index;
+}
+
+void PLIB_I2C_SlaveClockHold(I2C_MODULE_ID index)
+{
+    (void)index;
+}
+
+bool PLIB_I2C_SlaveReadIsRequested(I2C_MODULE_ID index)
+{
+    (void)index;
+    return false;
+}
+
+bool PLIB_I2C_SlaveAddressIsDetected(I2C_MODULE_ID index)
+{
+    (void)index;
+    return false;
+}
+
+bool PLIB_I2C_SlaveDataIsDetected(I2C_MODULE_ID index)
+{
+    (void)index;
+    return false;
+}
+
+bool PLIB_I2C_BusIsIdle(I2C_MODULE_ID index)
+{
+    (void)index;
+    _I2cPoll();
+    return hostPlib.i2cOp == HOST_I2C_IDLE;
+}
+
+void PLIB_I2C_MasterStart(I2C_MODULE_ID index)
+{
+    (void)index;
+    _I2cCommand(HOST_I2C_START);
+}
+
+void PLIB_I2C_MasterStartRepeat(I2C_MODULE_ID index)
+{
+    (void)index;
+    _I2cCommand(HOST_I2C_RESTART);
+}
+
+void PLIB_I2C_MasterStop(I2C_MODULE_ID index)
+{
+    (void)index;
+    _I2cCommand(HOST_I2C_STOP);
+}
+
+bool PLIB_I2C_StartWasDetected(I2C_MODULE_ID index)
+{
+    (void)index;
+    return hostPlib.i2cStart;
+}
+
+bool PLIB_I2C_StopWasDetected(I2C_MODULE_ID index)
+{
+    (void)index;
+    _I2cPoll();
+    return hostPlib.i2cStop;
+}
+
+bool PLIB_I2C_ArbitrationLossHasOccurred(I2C_MODULE_ID index)
+{
+    (void)index;
+    return false;
+}
+
+void PLIB_I2C_ArbitrationLossClear(I2C_MODULE_ID index)
+{
+    (void)index;
+}
+
+bool PLIB_I2C_ReceiverOverflowHasOccurred(I2C_MODULE_ID index)
+{
+    (void)index;
+    return false;
+}
+
+void PLIB_I2C_ReceiverOverflowClear(I2C_MODULE_ID index)
+{
+    (void)index;
+}
+
+bool PLIB_I2C_TransmitterOverflowHasOccurred(I2C_MODULE_ID index)
+{
+    (void)index;
+    return false;
+}
+
+void PLIB_I2C_TransmitterOverflowClear(I2C_MODULE_ID index)
+{
+    (void)index;
+}
+
+bool PLIB_I2C_TransmitterIsReady(I2C_MODULE_ID index)
+{
+    (void)index;
+    _I2cPoll();
+    return hostPlib.i2cOp != HOST_I2C_TX;
+}
+
+bool PLIB_I2C_TransmitterIsBusy(I2C_MODULE_ID index)
+{
+    (void)index;
+    _I2cPoll();
+    return hostPlib.i2cOp == HOST_I2C_TX;
+}
+
+void PLIB_I2C_TransmitterByteSend(I2C_MODULE_ID index, uint8_t data)
+{
+    (void)index;
+    hostPlib.i2cTrn = data;
+    _I2cCommand(HOST_I2C_TX);
+}
+
+bool PLIB_I2C_TransmitterByteHasCompleted(I2C_MODULE_ID index)
+{
+    (void)index;
+    _I2cPoll();
+    return hostPlib.i2cOp != HOST_I2C_TX;
+}
+
+bool PLIB_I2C_TransmitterByteWasAcknowledged(I2C_MODULE_ID index)
+{
+    (void)index;
+    return !hostPlib.i2cNack;
+}
+
+void PLIB_I2C_MasterReceiverClock1Byte(I2C_MODULE_ID index)
+{
+    (void)index;
+    _I2cCommand(HOST_I2C_RX);
+}
+
+bool PLIB_I2C_ReceivedByteIsAvailable(I2C_MODULE_ID index)
+{
+    (void)index;
+    _I2cPoll();
+    return hostPlib.i2cRbf;
+}
+
+uint8_t PLIB_I2C_ReceivedByteGet(I2C_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.i2cRbf = false;
+    return hostPlib.i2cRcv;
+}
+
+bool PLIB_I2C_MasterReceiverReadyToAcknowledge(I2C_MODULE_ID index)
+{
+    (void)index;
+    _I2cPoll();
+    return hostPlib.i2cOp == HOST_I2C_IDLE;
+}
+
+void PLIB_I2C_ReceivedByteAcknowledge(I2C_MODULE_ID index, bool ack)
+{
+    (void)index;
+    hostPlib.i2cAckDt = !ack;
+    _I2cCommand(HOST_I2C_ACK);
+}
+
+bool PLIB_I2C_ReceiverByteAcknowledgeHasCompleted(I2C_MODULE_ID index)
+{
+    (void)index;
+    return hostPlib.i2cOp != HOST_I2C_ACK;
+}
+
+// *****************************************************************************
+// Section: PLIB_USART (émission, cadencée par sim/host_uart.c)
+// *****************************************************************************
+
+void PLIB_USART_Enable(USART_MODULE_ID index)
+{
+    if (index == USART_ID_1)
+        hostPlib.uartEnabled = true;
+}
+
+void PLIB_USART_Disable(USART_MODULE_ID index)
+{
+    if (index == USART_ID_1)
+        hostPlib.uartEnabled = false;
+}
+
+void PLIB_USART_BaudRateHighEnable(USART_MODULE_ID index)
+{
+    if (index == USART_ID_1)
+        hostPlib.uartBrgh = true;
+}
+
+// Comme la PLIB : UxBRG arrondi au plus proche pour le diviseur courant
+void PLIB_USART_BaudRateSet(USART_MODULE_ID index, uint32_t clockFrequency, uint32_t baudRate)
+{
+    uint32_t div = hostPlib.uartBrgh ? 4 : 16;
+
+    if (index == USART_ID_1 && baudRate != 0)
+        hostPlib.uartBrg = (uint16_t)((clockFrequency + div * baudRate / 2) / (div * baudRate) - 1);
+}
+
+void PLIB_USART_LineControlModeSelect(USART_MODULE_ID index, USART_LINECONTROL_MODE dataFlowConfig)
+{
+    (void)index;
+    (void)dataFlowConfig;
+}
+
+void PLIB_USART_TransmitterEnable(USART_MODULE_ID index)
+{
+    if (index == USART_ID_1)
+        hostPlib.uartTxEnabled = true;
+}
+
+void PLIB_USART_TransmitterDisable(USART_MODULE_ID index)
+{
+    if (index == USART_ID_1)
+        hostPlib.uartTxEnabled = false;
+}
+
+void PLIB_USART_TransmitterInterruptModeSelect(USART_MODULE_ID index, USART_TRANSMIT_INTR_MODE fifolevel)
+{
+    (void)index;
+    (void)fifolevel;
+}
+
+void *PLIB_USART_TransmitterAddressGet(USART_MODULE_ID index)
+{
+    (void)index;
+    return &hostPlib.uartTxReg;
+}
+
+// *****************************************************************************
+// Section: PLIB_DMA (transferts faits par les modèles de sim/)
+// *****************************************************************************
+
+void PLIB_DMA_Enable(DMA_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.dmaEnabled = true;
+}
+
+void PLIB_DMA_Disable(DMA_MODULE_ID index)
+{
+    (void)index;
+    hostPlib.dmaEnabled = false;
+}
+
+void PLIB_DMA_ChannelXEnable(DMA_MODULE_ID index, DMA_CHANNEL channel)
+{
+    (void)index;
+    hostPlib.dma[channel].enabled = true;
+}
+
+void PLIB_DMA_ChannelXDisable(DMA_MODULE_ID index, DMA_CHANNEL channel)
+{
+    (void)index;
+    hostPlib.dma[channel].enabled = false;
+}
+
+bool PLIB_DMA_ChannelXIsEnabled(DMA_MODULE_ID index, DMA_CHANNEL channel)
+{
+    (void)index;
+    return hostPlib.dma[channel].enabled;
+}
+
+void PLIB_DMA_ChannelXPrioritySelect(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_CHANNEL_PRIORITY channelPriority)
+{
+    (void)index;
+    (void)channel;
+    (void)channelPriority;
+}
+
+void PLIB_DMA_ChannelXTriggerEnable(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_CHANNEL_TRIGGER_TYPE trigger)
+{
+    (void)index;
+    if (trigger == DMA_CHANNEL_TRIGGER_TRANSFER_START)
+        hostPlib.dma[channel].startIrqEn = true;
+}
+
+void PLIB_DMA_ChannelXStartIRQSet(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_TRIGGER_SOURCE IRQ)
+{
+    (void)index;
+    hostPlib.dma[channel].startIrq = IRQ;
+}
+
+void PLIB_DMA_ChannelXSourceStartAddressSet(DMA_MODULE_ID index, DMA_CHANNEL channel, uintptr_t sourceStartAddress)
+{
+    (void)index;
+    hostPlib.dma[channel].src = sourceStartAddress;
+}
+
+void PLIB_DMA_ChannelXDestinationStartAddressSet(DMA_MODULE_ID index, DMA_CHANNEL channel, uintptr_t destinationStartAddress)
+{
+    (void)index;
+    hostPlib.dma[channel].dst = destinationStartAddress;
+}
+
+void PLIB_DMA_ChannelXSourceSizeSet(DMA_MODULE_ID index, DMA_CHANNEL channel, uint16_t sourceSize)
+{
+    (void)index;
+    hostPlib.dma[channel].srcSize = sourceSize;
+}
+
+void PLIB_DMA_ChannelXDestinationSizeSet(DMA_MODULE_ID index, DMA_CHANNEL channel, uint16_t destinationSize)
+{
+    (void)index;
+    hostPlib.dma[channel].dstSize = destinationSize;
+}
+
+void PLIB_DMA_ChannelXCellSizeSet(DMA_MODULE_ID index, DMA_CHANNEL channel, uint16_t cellSize)
+{
+    (void)index;
+    hostPlib.dma[channel].cellSize = cellSize;
+}
+
+bool PLIB_DMA_ChannelXINTSourceFlagGet(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_INT_TYPE dmaINTSource)
+{
+    (void)index;
+    return (hostPlib.dma[channel].flags & dmaINTSource) != 0;
+}
+
+void PLIB_DMA_ChannelXINTSourceFlagClear(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_INT_TYPE dmaINTSource)
+{
+    (void)index;
+    hostPlib.dma[channel].flags &= (uint8_t)~dmaINTSource;
+}
@@ -0,0 +1,3 @@
+// Remplaçant hôte de <sys/kmem.h> (XC32) : adresses physiques = pointeurs
+#include <stdint.h>
+#define KVA_TO_PA(v)    ((uintptr_t)(v))
@@ -0,0 +1,2 @@
+// Remplaçant hôte de <xc.h> (XC32) : voir host_plib.h
+#include "host_plib.h"
@@ -0,0 +1,139 @@
+//--------------------------------------------------------
+//      host_i2c.c
+//--------------------------------------------------------
+//	Description :	Bus I2C1 simulé (voir host_i2c.h)
+//--------------------------------------------------------
+
+#include "host_i2c.h"
+#include "host_plib.h"
+#include "system_config.h"
+
+static HOST_I2C_DEVICE devices[HOST_I2C_DEVICES];
+static int deviceCount;
+static const HOST_I2C_DEVICE *selected;     // Esclave adressé
+static bool addressNext;                    // Prochain octet : adresse
+static uint32_t transfers;
+static uint8_t sdaHold;                     // Fronts SCL avant de relâcher SDA
+static bool sclLast;
+
+// SCL1 = RB8, SDA1 = RB9 (pilotées à la main quand le module est coupé)
+#define HOST_I2C_SCL    PORTS_BIT_POS_8
+#define HOST_I2C_SDA    PORTS_BIT_POS_9
+
+bool HOST_I2cAttach(const HOST_I2C_DEVICE *dev)
+{
+    if (deviceCount >= HOST_I2C_DEVICES)
+        return false;
+    devices[deviceCount++] = *dev;
+    return true;
+}
+
+// Start, restart, stop : un temps bit ; octet : 8 bits + acquittement
+uint32_t HOST_I2cTransfers(void)
+{
+    return transfers;
+}
+
+uint64_t HOST_I2cCycles(void)
+{
+    uint64_t bit = SYS_CLK_BUS_PERIPHERAL_1 / (hostPlib.i2cBaud ? hostPlib.i2cBaud : 100000);
+
+    switch (hostPlib.i2cOp)
+    {
+        case HOST_I2C_TX:
+        case HOST_I2C_RX:
+            return 9 * bit;
+        default:
+            return bit;
+    }
+}
+
+static const HOST_I2C_DEVICE *_Find(uint8_t address)
+{
+    int i;
+
+    for (i = 0; i < deviceCount; i++)
+    {
+        if (devices[i].address == address)
+            return &devices[i];
+    }
+    return NULL;
+}
+
+void HOST_I2cComplete(void)
+{
+    HOST_I2C_OP op = hostPlib.i2cOp;
+    uint8_t data = hostPlib.i2cTrn;
+
+    hostPlib.i2cOp = HOST_I2C_IDLE;
+    switch (op)
+    {
+        case HOST_I2C_START:
+            transfers++;
+            // Suite commune avec le restart
+        case HOST_I2C_RESTART:
+            hostPlib.i2cStart = true;
+            hostPlib.i2cStop = false;
+            addressNext = true;
+            break;
+
+        case HOST_I2C_STOP:
+            hostPlib.i2cStart = false;
+            hostPlib.i2cStop = true;
+            if (selected != NULL && selected->stop != NULL)
+                selected->stop(selected->ctx);
+            selected = NULL;
+            break;
+
+        case HOST_I2C_TX:
+            if (addressNext)
+            {
+                addressNext = false;
+                selected = _Find(data >> 1);
+                if (selected != NULL && selected->select != NULL)
+                    selected->select(selected->ctx, (data & 1) != 0);
+                hostPlib.i2cNack = (selected == NULL);
+            }
+            else
+                hostPlib.i2cNack = (selected == NULL || selected->write == NULL
+                                    || !selected->write(selected->ctx, data));
+            break;
+
+        case HOST_I2C_RX:
+            hostPlib.i2cRcv = (selected != NULL && selected->read != NULL)
+                              ? selected->read(selected->ctx) : 0xFF;
+            hostPlib.i2cRbf = true;
+            break;
+
+        case HOST_I2C_ACK:
+        default:
+            break;
+    }
+    hostPlib.intFlag[INT_SOURCE_I2C_1_MASTER] = true;
+}
+
+void HOST_I2cHoldSda(uint8_t pulses)
+{
+    sdaHold = pulses;
+    HOST_I2cPins();
+}
+
+bool HOST_I2cStalled(void)
+{
+    return sdaHold != 0;
+}
+
+// L'esclave bloqué termine son octet d'un bit par impulsion SCL produite
+// à la main ; SDA suit (pull-up quand elle est libre)
+void HOST_I2cPins(void)
+{
+    bool scl = (hostPlib.lat[PORT_CHANNEL_B] >> HOST_I2C_SCL) & 1u;
+
+    if (!hostPlib.i2cEnabled && scl && !sclLast && sdaHold != 0)
+        sdaHold--;
+    sclLast = scl;
+    if (sdaHold != 0)
+        hostPlib.port[PORT_CHANNEL_B] &= (uint16_t)~(1u << HOST_I2C_SDA);
+    else
+        hostPlib.port[PORT_CHANNEL_B] |= (uint16_t)(1u << HOST_I2C_SDA);
+}
@@ -0,0 +1,51 @@
+//--------------------------------------------------------
+//      host_i2c.h
+//--------------------------------------------------------
+//	Description :	Bus I2C1 simulé et esclaves du build hôte
+//                  Les commandes du maître (mock PLIB_I2C) durent le
+//                  temps de leurs bits à la vitesse programmée ; à la
+//                  fin, l'esclave adressé répond et l'interruption
+//                  maître I2C1 est levée.
+//--------------------------------------------------------
+
+#ifndef HOST_I2C_H
+#define HOST_I2C_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HOST_I2C_DEVICES    4
+
+// Esclave : appels à la fin de chaque séquence qui le concerne
+typedef struct
+{
+    uint8_t address;                        // Adresse 7 bits
+    void    (*select)(void *ctx, bool read); // Adressé (start ou restart)
+    bool    (*write)(void *ctx, uint8_t data); // Octet reçu ; vrai : ACK
+    uint8_t (*read)(void *ctx);             // Octet demandé par le maître
+    void    (*stop)(void *ctx);
+    void    *ctx;
+} HOST_I2C_DEVICE;
+
+bool     HOST_I2cAttach(const HOST_I2C_DEVICE *dev);
+
+// Transactions (start) vues sur le bus
+uint32_t HOST_I2cTransfers(void);
+
+// Durée de la séquence en cours (cycles PBCLK)
+uint64_t HOST_I2cCycles(void);
+
+// Fin de la séquence en cours (appelé par host_sim.c)
+void     HOST_I2cComplete(void);
+
+// Esclave bloqué au milieu d'un octet : SDA (RB9) retenue basse, plus
+// aucune séquence du maître ne se termine. Relâchée après pulses fronts
+// montants de SCL produits à la main (RB8, module coupé) : récupération
+// du bus. pulses = 0 : SDA libre.
+void     HOST_I2cHoldSda(uint8_t pulses);
+bool     HOST_I2cStalled(void);
+
+// Niveaux de SCL et SDA (appelé par host_sim.c à chaque pas)
+void     HOST_I2cPins(void);
+
+#endif
@@ -0,0 +1,230 @@
+//--------------------------------------------------------
+//      host_ina226.c
+//--------------------------------------------------------
+//	Description :	Modèle de l'INA226 sur le bus I2C1 simulé
+//                  Bus = Vout du modèle, shunt = Iout dans
+//                  HOST_INA_RSHUNT (même valeur que INA_RSHUNT de
+//                  app.c). Conversion continue au rythme du registre
+//                  de configuration : les mesures sont figées en fin de
+//                  mesure complète, qui lève CVRF et ALERT (RB7) selon
+//                  Mask/Enable.
+//--------------------------------------------------------
+
+#include <stddef.h>
+#include <math.h>
+#include "host_ina226.h"
+#include "host_i2c.h"
+#include "host_sim.h"
+#include "system_config.h"
+#include "plant.h"
+
+#define HOST_INA_ADDR       0x40        // A1 = A0 = GND
+#define HOST_INA_RSHUNT     0.01        // ohm
+#define HOST_INA_REGS       8
+#define HOST_INA_POR        0x4127      // Configuration à la mise sous tension
+
+// Mask/Enable : bits écrits et drapeaux
+#define MASK_FUNCTIONS      0xF800
+#define MASK_CNVR           0x0400
+#define MASK_AFF            0x0010
+#define MASK_CVRF           0x0008
+#define MASK_APOL           0x0002
+#define MASK_LEN            0x0001
+
+typedef struct
+{
+    uint16_t reg[HOST_INA_REGS];
+    uint8_t  pointer;
+    uint8_t  count;                     // Octets depuis l'adressage
+    uint16_t shift;                     // Mot en cours d'écriture/lecture
+    uint16_t flags;                     // AFF, CVRF
+    uint64_t due;                       // Fin de la mesure en cours
+    uint32_t conversions;
+} HOST_INA;
+
+static HOST_INA ina;
+
+static int16_t _Clamp16(double v)
+{
+    v = floor(v + 0.5);
+    if (v > 32767.0) return 32767;
+    if (v < -32768.0) return -32768;
+    return (int16_t)v;
+}
+
+// Sortie ALERT : collecteur ouvert, active basse sauf APOL
+static void _Alert(void)
+{
+    uint16_t mask = ina.reg[6];
+    bool asserted = ((mask & MASK_CNVR) && (ina.flags & MASK_CVRF))
+                    || (ina.flags & MASK_AFF);
+
+    HOST_SimPortInput(PORT_CHANNEL_B, PORTS_BIT_POS_7,
+                      asserted == ((mask & MASK_APOL) != 0));
+}
+
+// Fonction d'alerte validée (une seule prise en compte, poids fort)
+static bool _Limit(void)
+{
+    int16_t shunt = (int16_t)ina.reg[1];
+    int16_t limit = (int16_t)ina.reg[7];
+    uint16_t f = ina.reg[6] & MASK_FUNCTIONS;
+
+    if (f & 0x8000) return shunt > limit;
+    if (f & 0x4000) return shunt < limit;
+    if (f & 0x2000) return ina.reg[2] > ina.reg[7];
+    if (f & 0x1000) return ina.reg[2] < ina.reg[7];
+    if (f & 0x0800) return ina.reg[3] > ina.reg[7];
+    return false;
+}
+
+// Durée d'une mesure complète (cycles PBCLK) ; 0 hors conversion continue
+static uint64_t _Period(void)
+{
+    static const uint16_t avg[8] = { 1, 4, 16, 64, 128, 256, 512, 1024 };
+    static const uint16_t ct[8] = { 140, 204, 332, 588, 1100, 2116, 4156, 8244 };
+    uint16_t cfg = ina.reg[0];
+    uint64_t us = 0;
+
+    if ((cfg & 0x7) < 5)
+        return 0;
+    if (cfg & 0x2)
+        us += ct[(cfg >> 6) & 7];
+    if (cfg & 0x1)
+        us += ct[(cfg >> 3) & 7];
+    return us * avg[(cfg >> 9) & 7] * (SYS_CLK_BUS_PERIPHERAL_1 / 1000000ul);
+}
+
+static void _Schedule(void);
+
+// Fin de mesure : registres de résultat, drapeaux, ALERT
+static void _Convert(void)
+{
+    const PLANT_STATE *x = PLANT_State();
+    int16_t shunt = _Clamp16(x->iOut * HOST_INA_RSHUNT / 2.5e-6);
+    double bus = x->vOut / 1.25e-3;
+    double current = (double)shunt * ina.reg[5] / 2048.0;
+
+    ina.reg[1] = (uint16_t)shunt;
+    ina.reg[2] = (uint16_t)(bus < 0.0 ? 0 : bus > 32767.0 ? 32767 : bus + 0.5);
+    ina.reg[4] = (uint16_t)_Clamp16(current);
+    ina.reg[3] = (uint16_t)fabs((int16_t)ina.reg[4] * (double)ina.reg[2] / 20000.0);
+    ina.conversions++;
+
+    ina.flags |= MASK_CVRF;
+    if (_Limit())
+        ina.flags |= MASK_AFF;
+    else if (!(ina.reg[6] & MASK_LEN))
+        ina.flags &= (uint16_t)~MASK_AFF;   // Transparent : suit la mesure
+    _Alert();
+    _Schedule();
+}
+
+// Une seule mesure en cours : une reconfiguration relance la mesure,
+// l'événement planifié auparavant est ignoré
+static void _ConvertEvent(void)
+{
+    if (HOST_SimTime() == ina.due)
+        _Convert();
+}
+
+static void _Schedule(void)
+{
+    uint64_t period = _Period();
+
+    ina.due = 0;
+    if (period != 0 && HOST_SimSchedule(period, _ConvertEvent))
+        ina.due = HOST_SimTime() + period;
+}
+
+// Registre pointé ; la lecture de Mask/Enable efface CVRF (et AFF en
+// mode verrouillé) et relâche ALERT
+static uint16_t _Value(uint8_t reg)
+{
+    switch (reg)
+    {
+        case 0x06: return ina.reg[6] | ina.flags;
+        case 0xFE: return 0x5449;
+        case 0xFF: return 0x2260;
+        default:   return reg < HOST_INA_REGS ? ina.reg[reg] : 0xFFFF;
+    }
+}
+
+static void _Select(void *ctx, bool read)
+{
+    (void)ctx;
+    ina.count = 0;
+    if (!read)
+        return;
+    ina.shift = _Value(ina.pointer);
+    if (ina.pointer == 0x06)
+    {
+        ina.flags &= (uint16_t)~MASK_CVRF;
+        if (ina.reg[6] & MASK_LEN)
+            ina.flags &= (uint16_t)~MASK_AFF;
+        _Alert();
+    }
+}
+
+// Premier octet : pointeur ; puis mots de 16 bits (poids fort en tête)
+static bool _Write(void *ctx, uint8_t data)
+{
+    (void)ctx;
+    if (ina.count++ == 0)
+    {
+        ina.pointer = data;
+        return true;
+    }
+    ina.shift = (uint16_t)(ina.shift << 8) | data;
+    if ((ina.count & 1) == 1 && ina.pointer < HOST_INA_REGS)
+    {
+        if (ina.pointer == 0x00 && (ina.shift & 0x8000))
+        {
+            uint8_t i;                  // RST : registres par défaut
+            for (i = 1; i < HOST_INA_REGS; i++)
+                ina.reg[i] = 0;
+            ina.reg[0] = HOST_INA_POR;
+            ina.flags = 0;
+        }
+        else if (ina.pointer == 0x06)
+            ina.reg[6] = ina.shift & (MASK_FUNCTIONS | MASK_CNVR | MASK_APOL | MASK_LEN);
+        else if (ina.pointer == 0x00 || ina.pointer >= 0x05)
+            ina.reg[ina.pointer] = ina.shift;
+
+        if (ina.pointer == 0x00)
+            _Schedule();                // Nouvelle mesure complète
+        else if (ina.pointer == 0x06)
+            _Alert();
+    }
+    return true;
+}
+
+static uint8_t _Read(void *ctx)
+{
+    uint8_t data;
+
+    (void)ctx;
+    data = (ina.count & 1) ? (uint8_t)ina.shift : (uint8_t)(ina.shift >> 8);
+    if ((ina.count++ & 1) == 1)
+        ina.shift = _Value(ina.pointer);
+    return data;
+}
+
+void HOST_Ina226Attach(void)
+{
+    const HOST_I2C_DEVICE dev = { HOST_INA_ADDR, _Select, _Write, _Read, NULL, NULL };
+
+    ina.reg[0] = HOST_INA_POR;
+    HOST_I2cAttach(&dev);
+    _Schedule();
+}
+
+uint16_t HOST_Ina226Config(void)
+{
+    return ina.reg[0];
+}
+
+uint32_t HOST_Ina226Conversions(void)
+{
+    return ina.conversions;
+}
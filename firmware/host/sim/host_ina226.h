@@ -0,0 +1,18 @@
+//--------------------------------------------------------
+//      host_ina226.h
+//--------------------------------------------------------
+//	Description :	INA226 simulé sur le bus I2C1 (adresse 0x40),
+//                  mesurant la sortie du modèle de convertisseur ;
+//                  ALERT câblée sur RB7
+//--------------------------------------------------------
+
+#ifndef HOST_INA226_H
+#define HOST_INA226_H
+
+#include <stdint.h>
+
+void     HOST_Ina226Attach(void);
+uint16_t HOST_Ina226Config(void);   // Registre de configuration écrit
+uint32_t HOST_Ina226Conversions(void); // Mesures complètes effectuées
+
+#endif
@@ -0,0 +1,77 @@
+//--------------------------------------------------------
+//      host_lm92.c
+//--------------------------------------------------------
+//	Description :	Modèle du LM92 sur le bus I2C1 simulé
+//                  Température lue dans PLANT_Param()->temp au moment
+//                  de l'adressage en lecture (conversion supposée
+//                  continue) ; bits d'état à zéro.
+//--------------------------------------------------------
+
+#include <stddef.h>
+#include <math.h>
+#include "host_lm92.h"
+#include "host_i2c.h"
+#include "plant.h"
+
+#define HOST_LM92_ADDR      0x48        // A1 = A0 = GND
+
+typedef struct
+{
+    uint8_t  pointer;
+    uint8_t  count;                     // Octets depuis l'adressage
+    uint16_t shift;                     // Mot en cours de lecture
+    uint32_t reads;
+} HOST_LM92;
+
+static HOST_LM92 lm;
+
+// Registre de température : 0.0625 °C / LSB dans D15..D3
+static uint16_t _Temperature(void)
+{
+    double t = floor(PLANT_Param()->temp * 16.0 + 0.5);
+
+    if (t > 4095.0) t = 4095.0;
+    if (t < -4096.0) t = -4096.0;
+    return (uint16_t)((int16_t)t * 8);
+}
+
+static void _Select(void *ctx, bool read)
+{
+    (void)ctx;
+    lm.count = 0;
+    if (!read)
+        return;
+    switch (lm.pointer)
+    {
+        case 0x00: lm.shift = _Temperature(); lm.reads++; break;
+        case 0x07: lm.shift = 0x8001; break;
+        default:   lm.shift = 0; break;
+    }
+}
+
+// Premier octet : pointeur ; registres de seuils non modélisés
+static bool _Write(void *ctx, uint8_t data)
+{
+    (void)ctx;
+    if (lm.count++ == 0)
+        lm.pointer = data;
+    return true;
+}
+
+static uint8_t _Read(void *ctx)
+{
+    (void)ctx;
+    return (lm.count++ & 1) ? (uint8_t)lm.shift : (uint8_t)(lm.shift >> 8);
+}
+
+void HOST_Lm92Attach(void)
+{
+    const HOST_I2C_DEVICE dev = { HOST_LM92_ADDR, _Select, _Write, _Read, NULL, NULL };
+
+    HOST_I2cAttach(&dev);
+}
+
+uint32_t HOST_Lm92Reads(void)
+{
+    return lm.reads;
+}
@@ -0,0 +1,17 @@
+//--------------------------------------------------------
+//      host_lm92.h
+//--------------------------------------------------------
+//	Description :	LM92 simulé sur le bus I2C1 (adresse 0x48),
+//                  mesurant la température de carte du modèle
+//                  (paramètre / événement "temp")
+//--------------------------------------------------------
+
+#ifndef HOST_LM92_H
+#define HOST_LM92_H
+
+#include <stdint.h>
+
+void     HOST_Lm92Attach(void);
+uint32_t HOST_Lm92Reads(void);      // Lectures du registre de température
+
+#endif
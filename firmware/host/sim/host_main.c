@@ -0,0 +1,428 @@
+//--------------------------------------------------------
+//      host_main.c
+//--------------------------------------------------------
+//	Description :	Point d'entrée du build hôte
+//                  Remplace main.c : même séquence SYS_Initialize /
+//                  SYS_Tasks, les interruptions timer sont produites
+//                  par la base de temps simulée (host_sim.c).
+//
+//  Usage : tp4_host [options]
+//      -t s            durée simulée (défaut 1 s)
+//      -P clé=valeur   paramètre du convertisseur (voir plant.c)
+//      -e t:clé=valeur événement (vin, r, i, fault) à l'instant t
+//      -T v  -B b      consigne et bande de tolérance des mesures
+//      -o fichier      trace CSV par période PWM
+//      -u fichier      flux de télémétrie UART1 (trames COBS brutes)
+//      -s src:trig:niveau[:pre[:decim]]
+//                      capture déclenchée (src vout, iout, error, integ,
+//                      duty ; trig rise, fall, slope, fault), armée à la
+//                      place de la capture sur défaut de app.c
+//      -S fichier      capture figée en CSV
+//      -p              durées par zone (profile.h, horloge de l'hôte)
+//      -l cycles       durée d'un tour de super-boucle (PBCLK)
+//      -v code -i code entrées AN11/AN12 fixes, sans modèle
+//      -c n            compare PI et 3P3Z fixe / float sur n échantillons
+//--------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "system_config.h"
+#include "system_definitions.h"
+#include "regul.h"
+#include "comp.h"
+#include "pwm.h"
+#include "host_sim.h"
+#include "host_plant.h"
+#include "host_i2c.h"
+#include "i2cbus.h"
+#include "host_ina226.h"
+#include "host_lm92.h"
+#include "host_uart.h"
+#include "telem.h"
+#include "scope.h"
+#include "profile.h"
+
+#define HOST_LOOP_CYCLES    1000    // Durée simulée d'un tour de super-boucle
+#define HOST_TARGET_V       5.0     // Consigne de la carte (TARGET_V)
+#define HOST_BAND           0.02    // Bande d'établissement +-2 %
+#define HOST_LSB_VOUT       (3.3 / 1023.0 * 3.06)           // LSB_VOUT de app.c
+#define HOST_LSB_IOUT       (3.3 / 1023.0 / (21.0 * 0.03))  // LSB_IOUT de app.c
+#define HOST_CTRL_DECIM     1                               // CTRL_DECIM de app.c
+#define HOST_PWM_FREQ       10000ul                         // PWM_FREQ de app.c
+
+// ISR définies dans system_interrupt.c
+void IntHandlerDrvTmrInstance0(void);
+void IntHandlerDrvTmrInstance1(void);
+void IntHandlerDrvAdc(void);
+void IntHandlerDrvOCInstance0(void);
+void IntHandlerCmpInstance0(void);
+void IntHandlerChangeNotification(void);
+void IntHandlerDrvI2CInstance0(void);
+
+// Etat de l'application (app.c)
+extern APP_DATA appData;
+
+static uint64_t isrCount;
+static uint64_t isrNanos;
+
+static uint64_t _Nanos(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// ISR de régulation chronométrée
+static void _RegulIsr(void)
+{
+    uint64_t t0 = _Nanos();
+    IntHandlerDrvAdc();
+    isrNanos += _Nanos() - t0;
+    isrCount++;
+}
+
+//------------------------------------------------------------------------------
+// Comparaison des moteurs PI : même suite d'erreurs, écart max en rapport
+// cyclique (et en pas de OC1RS à la fréquence de app.c). Gains par défaut
+// identiques à app.c.
+
+static int _ComparePi(long n)
+{
+    const float lsb = 3.3f / 1023.0f * 3.06f;
+    const PI_FLOAT_PARAM pf = { 1.0f, 40.0f, 0.0001f, 0.0f, 1.0f };
+    const PI_FIX_PARAM px = PI_FIX_PARAM_INIT(1.0f, 40.0f, 0.0001f, lsb, 0.0, 1.0);
+    PI_FLOAT_STATE sf;
+    PI_FIX_STATE sx;
+    double maxDiff = 0.0;
+    long k;
+
+    PI_ResetFloat(&sf);
+    PI_ResetFix(&sx);
+    PWM_Configure(HOST_PWM_FREQ);
+    srand(1);
+
+    for (k = 0; k < n; k++)
+    {
+        int32_t err = (rand() % 201) - 100;   // +-100 codes (~1 V)
+        float yf = PI_StepFloat(&pf, &sf, err * lsb);
+        float yx = (float)PI_StepFix(&px, &sx, err) / 2147483648.0f;
+        double d = yf > yx ? yf - yx : yx - yf;
+
+        // Hors saturation la référence float n'est pas bornée : on resynchronise
+        if (yf <= 0.0f || yf >= 1.0f)
+        {
+            PI_ResetFloat(&sf);
+            PI_ResetFix(&sx);
+            continue;
+        }
+        if (d > maxDiff)
+            maxDiff = d;
+    }
+
+    printf("compare: %ld samples, max |float - fix| = %.3g (%.2f LSB PWM)\n",
+           n, maxDiff, maxDiff * PWM_PeriodTicks());
+    return 0;
+}
+
+// Même comparaison pour un 3P3Z (pôles 0.9, 0.5, 0.2) : les deux versions
+// bornent et mémorisent la sortie de la même façon, pas de resynchronisation
+static int _CompareComp(long n)
+{
+    const float lsb = 3.3f / 1023.0f * 3.06f;
+    const COMP_FLOAT_PARAM cf =
+    {
+        COMP_3P3Z,
+        { 2.0f, -3.5f, 2.0f, -0.4f },
+        { 0.0f, 1.6f, -0.73f, 0.09f },
+        0.0f, 1.0f
+    };
+    COMP_FIX_PARAM cx;
+    COMP_FLOAT_STATE sf;
+    COMP_FIX_STATE sx;
+    double maxDiff = 0.0;
+    long k;
+
+    if (!COMP_InitFix(&cx, &cf, lsb))
+        return EXIT_FAILURE;
+    COMP_ResetFloat(&sf);
+    COMP_ResetFix(&sx);
+    srand(1);
+
+    for (k = 0; k < n; k++)
+    {
+        int32_t err = (rand() % 41) - 20;
+        float yf = COMP_StepFloat(&cf, &sf, err * lsb);
+        float yx = (float)COMP_StepFix(&cx, &sx, err) / 2147483648.0f;
+        double d = yf > yx ? yf - yx : yx - yf;
+
+        if (d > maxDiff)
+            maxDiff = d;
+    }
+
+    printf("compare 3P3Z (Q%u): %ld samples, max |float - fix| = %.3g\n",
+           31 - cx.shift, n, maxDiff);
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Capture déclenchée : src:trig:niveau[:pre[:decim]]
+
+static bool _ParseScope(const char *spec, SCOPE_CONFIG *cfg)
+{
+    static const char *const sources[] = { "vout", "iout", "error", "integ", "duty" };
+    static const char *const triggers[] = { "rise", "fall", "slope", "fault" };
+    char src[8], trig[8];
+    int level, pre = SCOPE_DEPTH / 4, decim = 1, n;
+    unsigned i;
+
+    n = sscanf(spec, "%7[^:]:%7[^:]:%d:%d:%d", src, trig, &level, &pre, &decim);
+    if (n < 3 || pre < 0 || pre >= SCOPE_DEPTH || decim < 1 || decim > 255)
+        return false;
+    cfg->source = 0xFF;
+    cfg->trigger = 0xFF;
+    for (i = 0; i < sizeof(sources) / sizeof(sources[0]); i++)
+        if (strcmp(src, sources[i]) == 0)
+            cfg->source = (uint8_t)i;
+    for (i = 0; i < sizeof(triggers) / sizeof(triggers[0]); i++)
+        if (strcmp(trig, triggers[i]) == 0)
+            cfg->trigger = (uint8_t)i;
+    cfg->level = (int16_t)level;
+    cfg->pre = (uint16_t)pre;
+    cfg->decim = (uint8_t)decim;
+    return cfg->source != 0xFF && cfg->trigger != 0xFF;
+}
+
+// Capture figée, temps relatif au déclenchement
+static void _ScopeDump(FILE *out, double stepSeconds, uint8_t decim)
+{
+    uint16_t trig = SCOPE_TriggerIndex();
+    SCOPE_SAMPLE s;
+    uint16_t k;
+
+    fprintf(out, "t_ms,vout_V,iout_A,error_code,integ,duty\n");
+    for (k = 0; SCOPE_Read(k, &s); k++)
+        fprintf(out, "%.4f,%.4f,%.4f,%d,%.5f,%u\n",
+                ((double)k - trig) * decim * stepSeconds * 1e3,
+                s.vOut * HOST_LSB_VOUT, s.iOut * HOST_LSB_IOUT,
+                s.error, s.integ / 32768.0, s.duty);
+}
+
+static void _PutLine(const char *text)
+{
+    puts(text);
+}
+
+static void _Usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-t s] [-P key=val] [-e t:key=val] [-T v] [-B b]\n"
+                    "          [-o trace.csv] [-u telem.bin] [-s src:trig:level[:pre[:decim]]]\n"
+                    "          [-S scope.csv] [-p] [-l cycles] [-v code -i code] [-c n]\n", name);
+}
+
+int main(int argc, char **argv)
+{
+    double seconds = 1.0;
+    double vTarget = HOST_TARGET_V, band = HOST_BAND;
+    int vCode = -1, iCode = -1;
+    long compare = 0;
+    uint64_t loop = HOST_LOOP_CYCLES;
+    const char *tracePath = NULL;
+    FILE *traceFile = NULL;
+    const char *uartPath = NULL;
+    FILE *uartFile = NULL;
+    TELEM_STATS telem;
+    const char *scopePath = NULL;
+    SCOPE_CONFIG scope = { 0, 0, 0, 0, 1 };  // decim : CAPTURE_DECIM de app.c
+    bool scopeSet = false;
+    double stepSeconds;
+    bool profile = false;
+    static const char *const scopeStates[] = { "idle", "armed", "triggered", "done" };
+    PLANT_PARAM plant;
+    uint64_t end, t0;
+    int opt, i;
+
+    PLANT_DefaultParam(&plant);
+
+    while ((opt = getopt(argc, argv, "t:v:i:c:P:e:T:B:o:u:s:S:pl:")) != -1)
+    {
+        switch (opt)
+        {
+            case 't': seconds = atof(optarg); break;
+            case 'v': vCode = atoi(optarg); break;
+            case 'i': iCode = atoi(optarg); break;
+            case 'c': compare = atol(optarg); break;
+            case 'T': vTarget = atof(optarg); break;
+            case 'B': band = atof(optarg); break;
+            case 'o': tracePath = optarg; break;
+            case 'u': uartPath = optarg; break;
+            case 'S': scopePath = optarg; break;
+            case 'p': profile = true; break;
+            case 's':
+                if (!_ParseScope(optarg, &scope))
+                {
+                    fprintf(stderr, "bad capture spec: %s\n", optarg);
+                    return EXIT_FAILURE;
+                }
+                scopeSet = true;
+                break;
+            case 'l': loop = strtoull(optarg, NULL, 0); break;
+            case 'P':
+                if (!PLANT_ParseSet(&plant, optarg))
+                {
+                    fprintf(stderr, "bad plant parameter: %s\n", optarg);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'e':
+                if (!PLANT_ParseEvent(optarg))
+                {
+                    fprintf(stderr, "bad event: %s\n", optarg);
+                    return EXIT_FAILURE;
+                }
+                break;
+            default:
+                _Usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    if (compare > 0)
+        return _ComparePi(compare) || _CompareComp(compare);
+    if (loop == 0)
+        loop = HOST_LOOP_CYCLES;
+
+    HOST_SimInit();
+    HOST_SimAttachIsr(INT_SOURCE_TIMER_1, IntHandlerDrvTmrInstance0);
+    HOST_SimAttachIsr(INT_SOURCE_TIMER_2, IntHandlerDrvTmrInstance1);
+    HOST_SimAttachIsr(INT_SOURCE_ADC_1, _RegulIsr);
+    HOST_SimAttachIsr(INT_SOURCE_OUTPUT_COMPARE_1, IntHandlerDrvOCInstance0);
+    HOST_SimAttachIsr(INT_SOURCE_COMPARATOR_1, IntHandlerCmpInstance0);
+    HOST_SimAttachIsr(INT_SOURCE_I2C_1_MASTER, IntHandlerDrvI2CInstance0);
+    HOST_SimAttachIsr(INT_SOURCE_I2C_1_ERROR, IntHandlerDrvI2CInstance0);
+    HOST_SimAttachIsr(INT_SOURCE_CHANGE_NOTICE_B, IntHandlerChangeNotification);
+    HOST_Ina226Attach();
+    HOST_Lm92Attach();
+
+    if (vCode >= 0 || iCode >= 0)
+    {
+        // Boucle ouverte : entrées ADC constantes
+        HOST_SimAdcInput(ADC_INPUT_POSITIVE_AN11, (uint16_t)(vCode > 0 ? vCode : 0));
+        HOST_SimAdcInput(ADC_INPUT_POSITIVE_AN12, (uint16_t)(iCode > 0 ? iCode : 0));
+    }
+    else
+    {
+        PLANT_Init(&plant);
+        HOST_PlantAttach(vTarget, band);
+        if (tracePath != NULL)
+        {
+            traceFile = fopen(tracePath, "w");
+            if (traceFile == NULL)
+            {
+                perror(tracePath);
+                return EXIT_FAILURE;
+            }
+            HOST_PlantTrace(traceFile);
+        }
+    }
+
+    if (uartPath != NULL)
+    {
+        uartFile = fopen(uartPath, "wb");
+        if (uartFile == NULL)
+        {
+            perror(uartPath);
+            return EXIT_FAILURE;
+        }
+        HOST_UartCapture(uartFile);
+    }
+
+    SYS_Initialize(NULL);
+
+    end = (uint64_t)(seconds * SYS_CLK_BUS_PERIPHERAL_1);
+    t0 = _Nanos();
+    while (HOST_SimTime() < end)
+    {
+        SYS_Tasks();
+        // Capture de la ligne de commande : après l'armement par défaut
+        // de APP_RegulationStart()
+        if (scopeSet && appData.state == APP_STATE_WAIT)
+        {
+            SCOPE_Arm(&scope);
+            scopeSet = false;
+        }
+        HOST_SimAdvance(loop);
+    }
+
+    printf("sim %.3f s in %.3f s wall, %llu control ISR, %.1f ns/ISR\n",
+           HOST_SimSeconds(), (_Nanos() - t0) * 1e-9,
+           (unsigned long long)isrCount,
+           isrCount ? (double)isrNanos / isrCount : 0.0);
+    printf("PWM %lu Hz (%lu ticks, %u bits)  OC1RS=%u  LATB=0x%04X\n",
+           (unsigned long)PWM_FrequencyGet(), (unsigned long)PWM_PeriodTicks(),
+           PWM_ResolutionBits(), hostPlib.ocRS, hostPlib.lat[PORT_CHANNEL_B]);
+    printf("faults: %u hw, %u sw, last cause 0x%02X at tick %lu\n",
+           appData.fault.hwCount, appData.fault.swCount, appData.fault.cause,
+           (unsigned long)appData.fault.tick);
+    printf("fault manager: state %u, latched 0x%02X, i2t %u %%\n",
+           appData.fault.state, appData.fault.latched, appData.fault.i2tPct);
+    printf("ilim: %u mA, %lu truncated pulses\n",
+           appData.ilim.thresholdmA, (unsigned long)appData.ilim.count);
+    printf("ina226: config 0x%04X, %lu samples, %lu errors, last %u mV %d mA\n",
+           HOST_Ina226Config(), (unsigned long)appData.ina.samples,
+           (unsigned long)appData.ina.errors, appData.ina.vBusmV, appData.ina.iOutmA);
+    printf("ina226 alert: %lu conversions, %lu I2C transfers, %lu over-limit, %lu kicks\n",
+           (unsigned long)HOST_Ina226Conversions(), (unsigned long)HOST_I2cTransfers(),
+           (unsigned long)appData.ina.alerts, (unsigned long)appData.ina.kicks);
+    printf("lm92: %lu reads, %lu errors, last %.2f C, derate %.3f (trip %u mA), limit %.3f V\n",
+           (unsigned long)HOST_Lm92Reads(), (unsigned long)appData.derate.errors,
+           appData.derate.temp16 / 16.0, appData.derate.kQ15 / 32768.0,
+           (unsigned)(appData.derate.iMaxCode * 3.3 / 1023.0 / (21.0 * 0.03) * 1000.0 + 0.5),
+           (appData.ss.limitQ16 / 65536.0) * 3.3 / 1023.0 * 3.06);
+    TELEM_StatsGet(&telem);
+    printf("telem: %lu frames, %lu samples, %u dropped, %llu UART bytes (%.0f %% of %.0f baud)\n",
+           (unsigned long)telem.frames, (unsigned long)telem.samples, telem.dropped,
+           (unsigned long long)HOST_UartBytes(),
+           HOST_SimSeconds() > 0.0 ? HOST_UartBytes() * 10.0 / HOST_SimSeconds()
+                                     / HOST_UartBaud() * 100.0 : 0.0,
+           HOST_UartBaud());
+    stepSeconds = (double)PWM_PeriodNs() * HOST_CTRL_DECIM * 1e-9;
+    if (SCOPE_State() == SCOPE_DONE)
+        printf("scope: %s, trigger at step %lu (%.4f s), %u samples (%u before)\n",
+               scopeStates[SCOPE_State()], (unsigned long)SCOPE_TriggerStep(),
+               SCOPE_TriggerStep() * stepSeconds, SCOPE_Length(), SCOPE_TriggerIndex());
+    else
+        printf("scope: %s, %u samples\n", scopeStates[SCOPE_State()], SCOPE_Length());
+    for (i = 0; i < I2CBUS_CLIENTS; i++)
+    {
+        I2CBUS_STATS st = { 0, 0, 0, 0, 0 };
+        I2CBUS_StatsGet((int8_t)i, &st);
+        if (st.transfers != 0)
+            printf("i2cbus client %d: %lu transfers, %lu errors (%lu timeouts), max wait %u ms, "
+                   "%lu throttled\n", i, (unsigned long)st.transfers, (unsigned long)st.errors,
+                   (unsigned long)st.timeouts, st.maxWaitMs, (unsigned long)st.throttled);
+    }
+
+    if (profile)
+        PROFILE_Dump(_PutLine);
+    if (vCode < 0 && iCode < 0)
+        HOST_PlantReport(stdout);
+    if (scopePath != NULL)
+    {
+        FILE *f = fopen(scopePath, "w");
+        if (f == NULL)
+        {
+            perror(scopePath);
+            return EXIT_FAILURE;
+        }
+        _ScopeDump(f, stepSeconds, scope.decim);
+        fclose(f);
+    }
+    if (traceFile != NULL)
+        fclose(traceFile);
+    if (uartFile != NULL)
+        fclose(uartFile);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,169 @@
+//--------------------------------------------------------
+//      host_plant.c
+//--------------------------------------------------------
+//	Description :	Couplage modèle / simulateur (voir host_plant.h)
+//--------------------------------------------------------
+
+#include "host_plant.h"
+#include "host_sim.h"
+#include "system_config.h"
+
+#define HOST_SEG_MAX    (PLANT_EVENT_MAX + 1)
+
+typedef struct
+{
+    double  start;
+    double  vMin;
+    double  vMax;
+    double  vEnd;
+    double  lastOut;        // Dernier instant hors bande
+    unsigned trips;
+} HOST_SEGMENT;
+
+static HOST_SEGMENT seg[HOST_SEG_MAX];
+static int segCount;
+static double target;
+static double tolerance;
+static double dutyLatched;
+static uint64_t lastTime;           // Instant atteint par le modèle (PBCLK)
+static uint64_t periodStart;        // Début de la période PWM courante
+static bool faultLed;
+static FILE *trace;
+
+static TMR_MODULE_ID _PwmTimer(void)
+{
+    return (hostPlib.ocTimer == OC_TIMER_16BIT_TMR3) ? TMR_ID_3 : TMR_ID_2;
+}
+
+// Sortie OC1 autorisée : mode PWM sans défaut ni troncature en cours,
+// driver non bloqué par ShutDown
+static bool _OcActive(void)
+{
+    return hostPlib.ocEnabled && !hostPlib.ocFault && !hostPlib.ocLow
+           && hostPlib.ocMode >= OC_COMPARE_PWM_MODE_WITHOUT_FAULT_PROTECTION
+           && !ShutDownStateGet();
+}
+
+static void _NewSegment(double t)
+{
+    HOST_SEGMENT *s;
+
+    if (segCount >= HOST_SEG_MAX)
+        return;
+    s = &seg[segCount++];
+    s->start = t;
+    s->vMin = 1e9;
+    s->vMax = -1e9;
+    s->vEnd = 0.0;
+    s->lastOut = t;
+    s->trips = 0;
+}
+
+static void _Record(const PLANT_STATE *x)
+{
+    HOST_SEGMENT *s = &seg[segCount - 1];
+    bool led = PLIB_PORTS_PinGetLatched(PORTS_ID_0, PORT_CHANNEL_B, PORTS_BIT_POS_6);
+    double err = x->vOut - target;
+
+    if (x->vOut < s->vMin) s->vMin = x->vOut;
+    if (x->vOut > s->vMax) s->vMax = x->vOut;
+    s->vEnd = x->vOut;
+    if (err > tolerance * target || err < -tolerance * target)
+        s->lastOut = x->time;
+    if (led && !faultLed)
+        s->trips++;
+    faultLed = led;
+}
+
+static void _Hook(TMR_MODULE_ID timer)
+{
+    TMR_MODULE_ID pwm = _PwmTimer();
+    HOST_TMR *tmr = &hostPlib.tmr[pwm];
+    uint64_t now = HOST_SimTime();
+    uint64_t span = ((uint64_t)tmr->period + 1) * PLIB_TMR_PrescaleGet(pwm);
+    double clk = (double)SYS_CLK_BUS_PERIPHERAL_1;
+    const PLANT_STATE *x;
+
+    // Les ISR exécutées au dernier appel (troncature, défaut) agissent
+    // dès cet instant
+    if (!_OcActive())
+        dutyLatched = 0.0;
+
+    if (now > lastTime)
+    {
+        if (PLANT_Advance(dutyLatched, (lastTime - periodStart) / clk,
+                          (now - lastTime) / clk, span / clk))
+            _NewSegment(lastTime / clk);
+        lastTime = now;
+    }
+
+    // Comparateur de défaut : OC1 coupé dès l'instant simulé courant
+    HOST_SimOcFaultInput(PLANT_FaultInput());
+    if (!_OcActive())
+        dutyLatched = 0.0;
+
+    x = PLANT_State();
+    HOST_SimAdcInput(ADC_INPUT_POSITIVE_AN11, PLANT_VoutCode());
+    HOST_SimAdcInput(ADC_INPUT_POSITIVE_AN12, PLANT_IoutCode());
+    HOST_SimCmpInput(x->iOut * PLANT_Param()->iGain); // C1INB = AN12
+
+    if (timer != pwm)
+        return;
+
+    // Début de période : OC1RS est recopié dans OC1R
+    periodStart = now;
+    hostPlib.ocLow = false;
+    if (_OcActive())
+        dutyLatched = (hostPlib.ocRS > tmr->period) ? 1.0 : hostPlib.ocRS / (tmr->period + 1.0);
+    else
+        dutyLatched = 0.0;
+
+    _Record(x);
+
+    if (trace != NULL)
+    {
+        const PLANT_PARAM *p = PLANT_Param();
+        fprintf(trace, "%.6f,%.3f,%.3f,%.3f,%.5f,%.4f,%.4f,%.4f,%u,%u,%d\n",
+                x->time, p->vin, p->rLoad, p->iLoad, dutyLatched,
+                x->iL, x->vOut, x->iOut,
+                hostPlib.adcInput[ADC_INPUT_POSITIVE_AN11],
+                hostPlib.adcInput[ADC_INPUT_POSITIVE_AN12], faultLed);
+    }
+}
+
+void HOST_PlantAttach(double vTarget, double band)
+{
+    target = vTarget;
+    tolerance = band;
+    dutyLatched = 0.0;
+    lastTime = HOST_SimTime();
+    periodStart = lastTime;
+    faultLed = false;
+    segCount = 0;
+    _NewSegment(0.0);
+    HOST_SimSetTimerHook(_Hook);
+}
+
+void HOST_PlantTrace(FILE *csv)
+{
+    trace = csv;
+    if (trace != NULL)
+        fprintf(trace, "t,vin,rload,iload,duty,il,vout,iout,an11,an12,fault\n");
+}
+
+void HOST_PlantReport(FILE *out)
+{
+    int i;
+
+    fprintf(out, "segment     start(s)   vmin(V)   vmax(V)   vend(V)  settle(ms)  trips\n");
+    for (i = 0; i < segCount; i++)
+    {
+        const HOST_SEGMENT *s = &seg[i];
+        fprintf(out, "%7d  %11.4f  %8.3f  %8.3f  %8.3f  ", i, s->start, s->vMin, s->vMax, s->vEnd);
+        if (s->vEnd - target <= tolerance * target && target - s->vEnd <= tolerance * target)
+            fprintf(out, "%10.2f", (s->lastOut - s->start) * 1e3);
+        else
+            fprintf(out, "%10s", "-");  // Pas établi dans la bande
+        fprintf(out, "  %5u\n", s->trips);
+    }
+}
@@ -0,0 +1,27 @@
+//--------------------------------------------------------
+//      host_plant.h
+//--------------------------------------------------------
+//	Description :	Couplage du modèle de convertisseur (plant.c) à la
+//                  base de temps simulée : à chaque expiration de timer,
+//                  le modèle est avancé jusqu'à l'instant courant avec
+//                  le rapport cyclique latché de OC1RS, et les codes
+//                  AN11/AN12 présentés à l'ADC sont mis à jour (les
+//                  conversions déclenchées par Timer3 voient donc l'état
+//                  du convertisseur au point d'échantillonnage).
+//
+//                  Mesures de réponse par segment (entre deux
+//                  événements) : min/max, temps d'établissement dans
+//                  la bande de tolérance, déclenchements de protection.
+//--------------------------------------------------------
+
+#ifndef HOST_PLANT_H
+#define HOST_PLANT_H
+
+#include <stdio.h>
+#include "plant.h"
+
+void HOST_PlantAttach(double vTarget, double band);
+void HOST_PlantTrace(FILE *csv);
+void HOST_PlantReport(FILE *out);
+
+#endif
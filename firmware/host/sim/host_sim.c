@@ -0,0 +1,361 @@
+//--------------------------------------------------------
+//      host_sim.c
+//--------------------------------------------------------
+//	Description :	Base de temps simulée du build hôte (voir host_sim.h)
+//--------------------------------------------------------
+
+#include "host_sim.h"
+#include "host_i2c.h"
+#include "host_uart.h"
+#include "system_config.h"
+
+#define HOST_AVDD       3.3         // Source de CVREF (V)
+#define HOST_RANK_UART  (HOST_TMR_NUM + 1 + HOST_SIM_EVENTS)
+
+static uint64_t simTime;                    // Cycles PBCLK écoulés
+static uint64_t tmrNext[HOST_TMR_NUM];      // Prochaine période de chaque timer
+static bool     tmrArmed[HOST_TMR_NUM];
+static uint64_t i2cNext;                    // Fin de la séquence I2C en cours
+static bool     i2cArmed;
+static uint64_t uartNext;                   // Fin du bloc DMA -> UART1
+static bool     uartArmed;
+static uint64_t eventAt[HOST_SIM_EVENTS];   // Événements ponctuels
+static HOST_EVENT eventFn[HOST_SIM_EVENTS]; // NULL : libre
+static HOST_ISR isrTable[INT_SOURCE_NUM];
+static HOST_TMR_HOOK tmrHook;
+
+static const INT_SOURCE tmrSource[HOST_TMR_NUM] =
+{
+    INT_SOURCE_TIMER_1, INT_SOURCE_TIMER_2, INT_SOURCE_TIMER_3,
+    INT_SOURCE_NUM, INT_SOURCE_NUM
+};
+
+void HOST_SimInit(void)
+{
+    int i;
+
+    simTime = 0;
+    tmrHook = NULL;
+    for (i = 0; i < HOST_TMR_NUM; i++)
+        tmrArmed[i] = false;
+    i2cArmed = false;
+    uartArmed = false;
+    for (i = 0; i < HOST_SIM_EVENTS; i++)
+        eventFn[i] = NULL;
+    for (i = 0; i < INT_SOURCE_NUM; i++)
+        isrTable[i] = NULL;
+    HOST_PlibReset();
+}
+
+void HOST_SimAttachIsr(INT_SOURCE source, HOST_ISR isr)
+{
+    isrTable[source] = isr;
+}
+
+void HOST_SimSetTimerHook(HOST_TMR_HOOK hook)
+{
+    tmrHook = hook;
+}
+
+uint64_t HOST_SimTime(void)
+{
+    return simTime;
+}
+
+bool HOST_SimSchedule(uint64_t cycles, HOST_EVENT fn)
+{
+    int i;
+
+    for (i = 0; i < HOST_SIM_EVENTS; i++)
+    {
+        if (eventFn[i] == NULL)
+        {
+            eventAt[i] = simTime + cycles;
+            eventFn[i] = fn;
+            return true;
+        }
+    }
+    return false;
+}
+
+double HOST_SimSeconds(void)
+{
+    return (double)simTime / (double)SYS_CLK_BUS_PERIPHERAL_1;
+}
+
+void HOST_SimAdcInput(ADC_INPUTS_POSITIVE input, uint16_t code)
+{
+    hostPlib.adcInput[input] = code;
+}
+
+// Mismatch : tout changement d'une broche validée lève le drapeau CN du
+// port (seul le port B a une source d'interruption dans le mock)
+void HOST_SimPortInput(PORTS_CHANNEL channel, PORTS_BIT_POS bit, bool level)
+{
+    uint16_t mask = (uint16_t)(1u << bit);
+    uint16_t old = hostPlib.port[channel];
+
+    hostPlib.port[channel] = level ? (old | mask) : (old & (uint16_t)~mask);
+    if (((old ^ hostPlib.port[channel]) & hostPlib.cnEnable[channel])
+        && channel == PORT_CHANNEL_B)
+        hostPlib.intFlag[INT_SOURCE_CHANGE_NOTICE_B] = true;
+}
+
+// En mode PWM avec défaut, le front actif de OCFA coupe OC1 (OCFLT) et
+// lève l'interruption OC1
+void HOST_SimOcFaultInput(bool asserted)
+{
+    if (asserted && !hostPlib.ocFault
+        && hostPlib.ocMode == OC_COMPARE_PWM_MODE_WITH_FAULT_PROTECTION)
+    {
+        hostPlib.ocFault = true;
+        hostPlib.intFlag[INT_SOURCE_OUTPUT_COMPARE_1] = true;
+    }
+    hostPlib.ocFaultPin = asserted;
+}
+
+// Comparateur 1 : C1INB contre CVREF (alimenté par AVDD) ou C1INA (à
+// la masse) ; le front choisi par CMP_INTERRUPT_EVENT lève CMP1
+void HOST_SimCmpInput(double volts)
+{
+    double plus = 0.0;
+    bool out, rise;
+
+    if (!hostPlib.cmpEnabled)
+        return;
+    if (hostPlib.cmpNonInv == CMP_NON_INVERTING_INPUT_CDAC && hostPlib.cvrEnabled)
+        plus = hostPlib.cvrWide ? HOST_AVDD * hostPlib.cvrValue / 24.0
+                                : HOST_AVDD * (0.25 + hostPlib.cvrValue / 32.0);
+    out = (plus > volts) != hostPlib.cmpInvert;
+    rise = out && !hostPlib.cmpOut;
+
+    if (out != hostPlib.cmpOut
+        && (hostPlib.cmpEvent == CMP_INTERRUPT_GENERATION_BOTH
+            || (rise && hostPlib.cmpEvent == CMP_INTERRUPT_GENERATION_LOW_TO_HIGH)
+            || (!rise && hostPlib.cmpEvent == CMP_INTERRUPT_GENERATION_HIGH_TO_LOW)))
+        hostPlib.intFlag[INT_SOURCE_COMPARATOR_1] = true;
+    hostPlib.cmpOut = out;
+}
+
+static uint32_t _TmrDivisor(int i)
+{
+    return PLIB_TMR_PrescaleGet((TMR_MODULE_ID)i);
+}
+
+// Entrée convertie au rang n de la séquence : MUX A, alternance A/B ou
+// balayage des entrées validées (ordre croissant)
+static ADC_INPUTS_POSITIVE _AdcInput(int n)
+{
+    if (hostPlib.adcScan && hostPlib.adcScanMask != 0)
+    {
+        int count = 0, i;
+        for (i = 0; i < HOST_ADC_BUF; i++)
+            if (hostPlib.adcScanMask & (1u << i))
+                count++;
+        n %= count;
+        for (i = 0; i < HOST_ADC_BUF; i++)
+            if ((hostPlib.adcScanMask & (1u << i)) && n-- == 0)
+                return (ADC_INPUTS_POSITIVE)i;
+    }
+    if (hostPlib.adcSamplingMode == ADC_SAMPLING_MODE_ALTERNATE_INPUT && (n & 1))
+        return hostPlib.adcPosB;
+    return hostPlib.adcPosA;
+}
+
+// Une conversion : rangée dans la moitié du buffer en cours de
+// remplissage ; la fin de séquence (SMPI + 1 conversions) bascule BUFS
+// et lève le drapeau d'interruption
+static void _AdcConvertOne(void)
+{
+    int base = (hostPlib.adcBufMode == ADC_BUFFER_MODE_TWO_8WORD_BUFFERS && hostPlib.adcFillHigh)
+               ? HOST_ADC_BUF / 2 : 0;
+    int n = hostPlib.adcSeqPos;
+
+    hostPlib.adcBuf[(base + n) & (HOST_ADC_BUF - 1)] = hostPlib.adcInput[_AdcInput(n)];
+
+    if (++hostPlib.adcSeqPos > hostPlib.adcSamplesPerInt)
+    {
+        hostPlib.adcSeqPos = 0;
+        if (hostPlib.adcBufMode == ADC_BUFFER_MODE_TWO_8WORD_BUFFERS)
+            hostPlib.adcFillHigh = !hostPlib.adcFillHigh;
+        hostPlib.adcDone = true;
+        hostPlib.intFlag[INT_SOURCE_ADC_1] = true;
+    }
+}
+
+// Conversions provoquées par l'expiration d'un timer :
+//  - déclenchement Timer3 : une conversion par période de Timer3
+//  - compteur interne : conversion continue, séquence complète à chaque
+//    événement simulé
+// Sans échantillonnage automatique, une seule conversion par SAMP.
+static void _AdcConvert(TMR_MODULE_ID timer)
+{
+    int n;
+
+    if (!hostPlib.adcEnabled || !(hostPlib.adcAutoSample || hostPlib.adcSampling))
+        return;
+
+    if (hostPlib.adcTrigger == ADC_CONVERSION_TRIGGER_TMR3_COMPARE_MATCH)
+    {
+        if (timer == TMR_ID_3)
+            _AdcConvertOne();
+    }
+    else if (!hostPlib.adcAutoSample)
+        _AdcConvertOne();
+    else
+    {
+        for (n = (int)hostPlib.adcSamplesPerInt - hostPlib.adcSeqPos; n >= 0; n--)
+            _AdcConvertOne();
+    }
+
+    if (!hostPlib.adcAutoSample)
+        hostPlib.adcSampling = false;
+}
+
+// Appel des ISR dont le drapeau et la validation sont actifs
+static void _Dispatch(void)
+{
+    int s;
+
+    if (!hostPlib.intGlobal)
+        return;
+    for (s = 0; s < INT_SOURCE_NUM; s++)
+    {
+        if (hostPlib.intFlag[s] && hostPlib.intEnabled[s] && isrTable[s] != NULL)
+            isrTable[s]();
+    }
+}
+
+void HOST_SimAdvance(uint64_t cycles)
+{
+    uint64_t end = simTime + cycles;
+    int i;
+
+    for (;;)
+    {
+        uint64_t t = end;
+        int next = -1;
+
+        for (i = 0; i < HOST_TMR_NUM; i++)
+        {
+            HOST_TMR *tmr = &hostPlib.tmr[i];
+            if (!tmr->running)
+            {
+                tmrArmed[i] = false;
+                continue;
+            }
+            if (!tmrArmed[i])
+            {
+                tmrArmed[i] = true;
+                tmrNext[i] = simTime + (uint64_t)(tmr->period - tmr->counter + 1) * _TmrDivisor(i);
+            }
+            if (tmrNext[i] <= t)
+            {
+                t = tmrNext[i];
+                next = i;
+            }
+        }
+
+        // Séquence I2C lancée par le firmware : terminée après la durée
+        // de ses bits (événement traité comme un timer de rang HOST_TMR_NUM),
+        // jamais tant qu'un esclave retient SDA
+        HOST_I2cPins();
+        if (hostPlib.i2cOp == HOST_I2C_IDLE || HOST_I2cStalled())
+            i2cArmed = false;
+        else
+        {
+            if (!i2cArmed)
+            {
+                i2cArmed = true;
+                i2cNext = simTime + HOST_I2cCycles();
+            }
+            if (i2cNext <= t)
+            {
+                t = i2cNext;
+                next = HOST_TMR_NUM;
+            }
+        }
+
+        // Bloc DMA vers l'émetteur UART1 : terminé après l'émission de
+        // ses octets (rang HOST_RANK_UART)
+        if (!HOST_UartBusy())
+            uartArmed = false;
+        else
+        {
+            if (!uartArmed)
+            {
+                uartArmed = true;
+                uartNext = simTime + HOST_UartCycles();
+            }
+            if (uartNext <= t)
+            {
+                t = uartNext;
+                next = HOST_RANK_UART;
+            }
+        }
+        // Événements ponctuels des modèles (rang HOST_TMR_NUM + 1 + n)
+        for (i = 0; i < HOST_SIM_EVENTS; i++)
+        {
+            if (eventFn[i] != NULL && eventAt[i] <= t)
+            {
+                t = eventAt[i];
+                next = HOST_TMR_NUM + 1 + i;
+            }
+        }
+
+        if (next < 0)
+        {
+            simTime = end;
+            break;
+        }
+
+        if (next == HOST_TMR_NUM)
+        {
+            simTime = t;
+            i2cArmed = false;
+            HOST_I2cComplete();
+            _Dispatch();
+            continue;
+        }
+
+        if (next == HOST_RANK_UART)
+        {
+            simTime = t;
+            uartArmed = false;
+            HOST_UartComplete();
+            _Dispatch();
+            continue;
+        }
+        if (next > HOST_TMR_NUM)
+        {
+            HOST_EVENT fn = eventFn[next - HOST_TMR_NUM - 1];
+
+            simTime = t;
+            eventFn[next - HOST_TMR_NUM - 1] = NULL; // fn peut replanifier
+            fn();
+            _Dispatch();
+            continue;
+        }
+
+        simTime = t;
+        hostPlib.tmr[next].counter = 0;
+        tmrNext[next] += (uint64_t)(hostPlib.tmr[next].period + 1) * _TmrDivisor(next);
+
+        if (tmrHook != NULL)
+            tmrHook((TMR_MODULE_ID)next);
+        _AdcConvert((TMR_MODULE_ID)next);
+        if (tmrSource[next] != INT_SOURCE_NUM)
+            hostPlib.intFlag[tmrSource[next]] = true;
+        _Dispatch();
+    }
+
+    // Mise à jour des compteurs visibles par le firmware
+    for (i = 0; i < HOST_TMR_NUM; i++)
+    {
+        if (tmrArmed[i])
+        {
+            uint64_t left = (tmrNext[i] - simTime) / _TmrDivisor(i);
+            hostPlib.tmr[i].counter = (uint16_t)(hostPlib.tmr[i].period + 1 - left);
+        }
+    }
+}
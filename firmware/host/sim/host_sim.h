@@ -0,0 +1,46 @@
+//--------------------------------------------------------
+//      host_sim.h
+//--------------------------------------------------------
+//	Description :	Base de temps simulée du build hôte
+//                  Le temps est compté en cycles PBCLK. Les timers
+//                  simulés lèvent leur drapeau d'interruption à chaque
+//                  période et l'ISR attachée est appelée comme sur cible.
+//--------------------------------------------------------
+
+#ifndef HOST_SIM_H
+#define HOST_SIM_H
+
+#include <stdint.h>
+#include "host_plib.h"
+
+typedef void (*HOST_ISR)(void);
+typedef void (*HOST_TMR_HOOK)(TMR_MODULE_ID timer);
+typedef void (*HOST_EVENT)(void);
+
+#define HOST_SIM_EVENTS 4           // Événements ponctuels en attente
+
+void     HOST_SimInit(void);
+void     HOST_SimAttachIsr(INT_SOURCE source, HOST_ISR isr);
+void     HOST_SimSetTimerHook(HOST_TMR_HOOK hook);
+void     HOST_SimAdvance(uint64_t cycles);
+uint64_t HOST_SimTime(void);
+
+// Appel de fn dans cycles PBCLK (modèles d'esclaves : fin de
+// conversion...) ; faux si la table est pleine
+bool     HOST_SimSchedule(uint64_t cycles, HOST_EVENT fn);
+double   HOST_SimSeconds(void);
+
+// Tension présente sur une entrée analogique (en codes ADC)
+void     HOST_SimAdcInput(ADC_INPUTS_POSITIVE input, uint16_t code);
+
+// Niveau de l'entrée de défaut OCFA de OC1 (vrai : défaut)
+void     HOST_SimOcFaultInput(bool asserted);
+
+// Niveau d'une entrée logique ; un changement sur une broche validée
+// en change notification (port B) lève l'interruption CN
+void     HOST_SimPortInput(PORTS_CHANNEL channel, PORTS_BIT_POS bit, bool level);
+
+// Tension sur C1INB (entrée inverseuse du comparateur 1, V)
+void     HOST_SimCmpInput(double volts);
+
+#endif
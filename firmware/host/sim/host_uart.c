@@ -0,0 +1,77 @@
+//--------------------------------------------------------
+//      host_uart.c
+//--------------------------------------------------------
+//	Description :	Emetteur UART1 simulé (voir host_uart.h)
+//                  Le bloc est émis d'un seul tenant : le firmware ne
+//                  voit que sa fin (DMA_INT_BLOCK_TRANSFER_COMPLETE).
+//--------------------------------------------------------
+
+#include "host_uart.h"
+#include "host_plib.h"
+#include "system_config.h"
+
+#define HOST_UART_BITS  10              // Start, 8 bits, stop
+
+static FILE *capture;
+static uint64_t bytes;
+
+void HOST_UartCapture(FILE *file)
+{
+    capture = file;
+}
+
+uint64_t HOST_UartBytes(void)
+{
+    return bytes;
+}
+
+double HOST_UartBaud(void)
+{
+    return (double)SYS_CLK_BUS_PERIPHERAL_1
+           / ((hostPlib.uartBrgh ? 4.0 : 16.0) * (hostPlib.uartBrg + 1.0));
+}
+
+// Canal qui alimente l'émetteur ; NULL si aucun transfert possible
+static HOST_DMA *_Channel(void)
+{
+    int ch;
+
+    if (!hostPlib.dmaEnabled || !hostPlib.uartEnabled || !hostPlib.uartTxEnabled)
+        return NULL;
+    for (ch = 0; ch < DMA_NUMBER_OF_CHANNELS; ch++)
+    {
+        HOST_DMA *dma = &hostPlib.dma[ch];
+
+        if (dma->enabled && dma->startIrqEn && dma->startIrq == DMA_TRIGGER_USART_1_TRANSMIT
+            && dma->dst == (uintptr_t)&hostPlib.uartTxReg && dma->srcSize != 0)
+            return dma;
+    }
+    return NULL;
+}
+
+bool HOST_UartBusy(void)
+{
+    return _Channel() != NULL;
+}
+
+uint64_t HOST_UartCycles(void)
+{
+    const HOST_DMA *dma = _Channel();
+    uint64_t bitCycles = (uint64_t)(hostPlib.uartBrgh ? 4 : 16) * (hostPlib.uartBrg + 1u);
+
+    return dma != NULL ? dma->srcSize * HOST_UART_BITS * bitCycles : 0;
+}
+
+void HOST_UartComplete(void)
+{
+    HOST_DMA *dma = _Channel();
+
+    if (dma == NULL)
+        return;
+    if (capture != NULL)
+        fwrite((const void *)dma->src, 1, dma->srcSize, capture);
+    hostPlib.uartTxReg = ((const uint8_t *)dma->src)[dma->srcSize - 1];
+    bytes += dma->srcSize;
+    dma->flags |= DMA_INT_BLOCK_TRANSFER_COMPLETE | DMA_INT_SOURCE_DONE;
+    dma->enabled = false;           // Sans CHAEN : arrêt en fin de bloc
+}
@@ -0,0 +1,29 @@
+//--------------------------------------------------------
+//      host_uart.h
+//--------------------------------------------------------
+//	Description :	Emetteur UART1 simulé, alimenté par DMA
+//                  Un canal DMA validé, déclenché par UART1 TX et écrivant
+//                  dans U1TXREG, émet son bloc au débit de U1BRG (8N1) ;
+//                  à la fin, les octets sont recopiés dans la capture, le
+//                  drapeau de fin de bloc est levé et le canal s'arrête.
+//--------------------------------------------------------
+
+#ifndef HOST_UART_H
+#define HOST_UART_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Flux émis recopié dans file (NULL : aucun)
+void     HOST_UartCapture(FILE *file);
+
+uint64_t HOST_UartBytes(void);      // Octets émis
+double   HOST_UartBaud(void);       // Débit programmé (bit/s)
+
+// Bloc DMA en cours d'émission (appelés par host_sim.c)
+bool     HOST_UartBusy(void);
+uint64_t HOST_UartCycles(void);     // Durée du bloc (cycles PBCLK)
+void     HOST_UartComplete(void);
+
+#endif
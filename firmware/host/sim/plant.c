@@ -0,0 +1,402 @@
+//--------------------------------------------------------
+//      plant.c
+//--------------------------------------------------------
+//	Description :	Modèle du convertisseur DC-DC (voir plant.h)
+//
+//  Pour un intervalle à topologie constante, avec
+//      a : l'inductance voit Vin (1) ou non (0)
+//      g : l'inductance débite dans la sortie (1) ou non (0)
+//      G = 1/rLoad, k = 1 + ESR.G
+//  on a (x = [iL, vC]) :
+//      L.diL/dt = a.Vin - (rL + g².ESR/k).iL - g/k.vC + g.ESR.I/k
+//      C.dvC/dt = (g.iL - G.vC - I) / k
+//  Le modèle moyen utilise les mêmes équations avec a, g moyennés.
+//--------------------------------------------------------
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "plant.h"
+
+#define PLANT_G_MIN     1e-9    // Conductance minimale (charge "à vide")
+#define PLANT_RL_MIN    1e-6
+#define PLANT_ADC_MAX   1023
+#define PLANT_ZC_ITER   32      // Itérations de recherche du zéro de iL
+
+typedef struct
+{
+    double p, q, r, s;  // Matrice d'état
+    double b0, b1;      // Entrée constante
+    double k, g;
+} PLANT_LIN;
+
+static PLANT_PARAM prm;
+static PLANT_STATE st;
+static PLANT_EVENT events[PLANT_EVENT_MAX];
+static int eventCount;
+static int eventNext;
+static double lastG;            // g de l'intervalle courant (mesure de vOut)
+static uint32_t rng = 1;
+
+void PLANT_DefaultParam(PLANT_PARAM *p)
+{
+    p->topology = PLANT_BUCK;
+    p->model = PLANT_SWITCHED;
+    p->l = 220e-6;
+    p->rl = 0.1;
+    p->c = 470e-6;
+    p->esr = 0.05;
+    p->vin = 12.0;
+    p->rLoad = 10.0;
+    p->iLoad = 0.0;
+    p->vref = 3.3;
+    p->vGain = 3.06;
+    p->iGain = 21.0 * 0.03; // ReadIout : I = V(AN12) / SHUNT_GAIN / SHUNT_R
+    p->noise = 0;
+    p->iTrip = 0.0;
+    p->fault = 0;
+    p->temp = 25.0;
+}
+
+static double _Conductance(void)
+{
+    return (prm.rLoad > 0.0) ? 1.0 / prm.rLoad + PLANT_G_MIN : PLANT_G_MIN;
+}
+
+static void _Linear(PLANT_LIN *m, double a, double g)
+{
+    double G = _Conductance();
+    double rl = (prm.rl > PLANT_RL_MIN) ? prm.rl : PLANT_RL_MIN;
+
+    m->k = 1.0 + prm.esr * G;
+    m->g = g;
+    m->p = -(rl + g * g * prm.esr / m->k) / prm.l;
+    m->q = -g / (m->k * prm.l);
+    m->r = g / (m->k * prm.c);
+    m->s = -G / (m->k * prm.c);
+    m->b0 = (a * prm.vin + g * prm.esr * prm.iLoad / m->k) / prm.l;
+    m->b1 = -prm.iLoad / (m->k * prm.c);
+}
+
+// x(t) = xe + exp(A.t).(x0 - xe), exp(A.t) en forme fermée (Cayley-Hamilton)
+static void _Propagate(const PLANT_LIN *m, const double x0[2], double t, double x[2])
+{
+    double det = m->p * m->s - m->q * m->r;
+    double xe0 = -(m->s * m->b0 - m->q * m->b1) / det;
+    double xe1 = -(-m->r * m->b0 + m->p * m->b1) / det;
+    double d0 = x0[0] - xe0;
+    double d1 = x0[1] - xe1;
+    double mid = 0.5 * (m->p + m->s);
+    double h = 0.5 * (m->p - m->s);
+    double disc = h * h + m->q * m->r;
+    double c, sn;
+
+    if (disc > 0.0)
+    {
+        double w = sqrt(disc);
+        if (w * t < 1e-6)
+        {
+            c = exp(mid * t);
+            sn = t * c;
+        }
+        else
+        {
+            double e1 = exp((mid + w) * t);
+            double e2 = exp((mid - w) * t);
+            c = 0.5 * (e1 + e2);
+            sn = (e1 - e2) / (2.0 * w);
+        }
+    }
+    else if (disc < 0.0)
+    {
+        double w = sqrt(-disc);
+        double em = exp(mid * t);
+        c = em * cos(w * t);
+        sn = em * sin(w * t) / w;
+    }
+    else
+    {
+        c = exp(mid * t);
+        sn = t * c;
+    }
+
+    x[0] = xe0 + (c + sn * h) * d0 + sn * m->q * d1;
+    x[1] = xe1 + sn * m->r * d0 + (c - sn * h) * d1;
+}
+
+// Intervalle de durée t, la diode bloque iL < 0
+static void _Segment(double a, double g, double t)
+{
+    PLANT_LIN m, idle;
+    double x0[2] = { st.iL, st.vC };
+    double x[2];
+
+    if (t <= 0.0)
+        return;
+
+    _Linear(&m, a, g);
+    _Linear(&idle, 0.0, 0.0);
+    lastG = g;
+
+    if (st.iL <= 0.0)
+    {
+        // Inductance démagnétisée : conduit seulement si la tension la polarise
+        double vo = st.vC + prm.esr * (-_Conductance() * st.vC - prm.iLoad) / m.k;
+        if (a * prm.vin - g * vo <= 0.0)
+        {
+            x0[0] = 0.0;
+            _Propagate(&idle, x0, t, x);
+            x[0] = 0.0;
+            lastG = 0.0;
+            goto done;
+        }
+    }
+
+    _Propagate(&m, x0, t, x);
+    if (x[0] < 0.0)
+    {
+        // Conduction discontinue : instant du passage à zéro par dichotomie
+        double lo = 0.0, hi = t;
+        int n;
+        for (n = 0; n < PLANT_ZC_ITER; n++)
+        {
+            double mid = 0.5 * (lo + hi);
+            _Propagate(&m, x0, mid, x);
+            if (x[0] > 0.0)
+                lo = mid;
+            else
+                hi = mid;
+        }
+        _Propagate(&m, x0, lo, x);
+        x[0] = 0.0;
+        _Propagate(&idle, x, t - lo, x);
+        x[0] = 0.0;
+        lastG = 0.0;
+    }
+
+done:
+    st.iL = x[0];
+    if (st.iL > st.iPeak)
+        st.iPeak = st.iL;
+    st.vC = (x[1] > 0.0) ? x[1] : 0.0;
+}
+
+static void _Outputs(void)
+{
+    double G = _Conductance();
+    double k = 1.0 + prm.esr * G;
+    double vo = st.vC + prm.esr * (lastG * st.iL - G * st.vC - prm.iLoad) / k;
+
+    st.vOut = (vo > 0.0) ? vo : 0.0;
+    st.iOut = (prm.rLoad > 0.0 ? st.vOut / prm.rLoad : 0.0) + (st.vOut > 0.0 ? prm.iLoad : 0.0);
+}
+
+void PLANT_Init(const PLANT_PARAM *p)
+{
+    prm = *p;
+    memset(&st, 0, sizeof(st));
+    eventNext = 0;
+    lastG = 1.0;
+    rng = 1;
+    _Outputs();
+}
+
+bool PLANT_AddEvent(double time, PLANT_EVENT_KIND kind, double value)
+{
+    int i;
+
+    if (eventCount >= PLANT_EVENT_MAX)
+        return false;
+
+    // Insertion triée par date
+    for (i = eventCount; i > 0 && events[i - 1].time > time; i--)
+        events[i] = events[i - 1];
+    events[i].time = time;
+    events[i].kind = kind;
+    events[i].value = value;
+    eventCount++;
+    return true;
+}
+
+static bool _ApplyEvents(void)
+{
+    bool applied = false;
+
+    while (eventNext < eventCount && events[eventNext].time <= st.time)
+    {
+        const PLANT_EVENT *ev = &events[eventNext++];
+        switch (ev->kind)
+        {
+            case PLANT_EV_VIN:   prm.vin = ev->value;   break;
+            case PLANT_EV_RLOAD: prm.rLoad = ev->value; break;
+            case PLANT_EV_ILOAD: prm.iLoad = ev->value; break;
+            case PLANT_EV_FAULT: prm.fault = (ev->value != 0.0); break;
+            case PLANT_EV_TEMP:  prm.temp = ev->value;  break;
+        }
+        applied = true;
+    }
+    return applied;
+}
+
+// Topologie de l'intervalle ON ou OFF (modèle commuté)
+static void _Switched(bool on, double t)
+{
+    if (prm.topology == PLANT_BUCK)
+        _Segment(on ? 1.0 : 0.0, 1.0, t);
+    else
+        _Segment(1.0, on ? 0.0 : 1.0, t);
+}
+
+bool PLANT_Advance(double duty, double phase, double dt, double period)
+{
+    bool applied = _ApplyEvents();
+
+    if (duty < 0.0) duty = 0.0;
+    if (duty > 1.0) duty = 1.0;
+    st.iPeak = st.iL;   // iL est extrême en fin d'intervalle
+
+    if (prm.model == PLANT_AVERAGED)
+    {
+        if (prm.topology == PLANT_BUCK)
+            _Segment(duty, 1.0, dt);
+        else
+            _Segment(1.0, 1.0 - duty, dt);
+    }
+    else
+    {
+        // Conduction sur [0, d.T[ de chaque période
+        double tOn = duty * period;
+        double end = phase + dt;
+
+        if (phase < tOn)
+            _Switched(true, ((end < tOn) ? end : tOn) - phase);
+        if (end > tOn)
+            _Switched(false, end - ((phase > tOn) ? phase : tOn));
+    }
+
+    st.time += dt;
+    _Outputs();
+    return applied;
+}
+
+const PLANT_STATE *PLANT_State(void)
+{
+    return &st;
+}
+
+const PLANT_PARAM *PLANT_Param(void)
+{
+    return &prm;
+}
+
+static uint16_t _Code(double volts)
+{
+    long code = lround(volts / prm.vref * PLANT_ADC_MAX);
+
+    if (prm.noise > 0)
+    {
+        // xorshift32 : bruit uniforme reproductible
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+        code += (long)(rng % (uint32_t)(2 * prm.noise + 1)) - prm.noise;
+    }
+    if (code < 0) code = 0;
+    if (code > PLANT_ADC_MAX) code = PLANT_ADC_MAX;
+    return (uint16_t)code;
+}
+
+uint16_t PLANT_VoutCode(void)
+{
+    return _Code(st.vOut / prm.vGain);
+}
+
+uint16_t PLANT_IoutCode(void)
+{
+    return _Code(st.iOut * prm.iGain);
+}
+
+bool PLANT_FaultInput(void)
+{
+    return (prm.fault != 0) || (prm.iTrip > 0.0 && st.iPeak > prm.iTrip);
+}
+
+//------------------------------------------------------------------------------
+// Ligne de commande : "clé=valeur" et "t:clé=valeur"
+
+static bool _ParseKind(const char *key, PLANT_EVENT_KIND *kind)
+{
+    if (strcmp(key, "vin") == 0)     *kind = PLANT_EV_VIN;
+    else if (strcmp(key, "r") == 0)  *kind = PLANT_EV_RLOAD;
+    else if (strcmp(key, "i") == 0)  *kind = PLANT_EV_ILOAD;
+    else if (strcmp(key, "fault") == 0) *kind = PLANT_EV_FAULT;
+    else if (strcmp(key, "temp") == 0)  *kind = PLANT_EV_TEMP;
+    else return false;
+    return true;
+}
+
+bool PLANT_ParseSet(PLANT_PARAM *p, const char *keyValue)
+{
+    char key[16];
+    const char *eq = strchr(keyValue, '=');
+    const char *val;
+    size_t len;
+
+    if (eq == NULL || (len = (size_t)(eq - keyValue)) >= sizeof(key))
+        return false;
+    memcpy(key, keyValue, len);
+    key[len] = '\0';
+    val = eq + 1;
+
+    if (strcmp(key, "topo") == 0)
+    {
+        if (strcmp(val, "buck") == 0)       p->topology = PLANT_BUCK;
+        else if (strcmp(val, "boost") == 0) p->topology = PLANT_BOOST;
+        else return false;
+    }
+    else if (strcmp(key, "model") == 0)
+    {
+        if (strcmp(val, "sw") == 0)         p->model = PLANT_SWITCHED;
+        else if (strcmp(val, "avg") == 0)   p->model = PLANT_AVERAGED;
+        else return false;
+    }
+    else if (strcmp(key, "L") == 0)     p->l = atof(val);
+    else if (strcmp(key, "rl") == 0)    p->rl = atof(val);
+    else if (strcmp(key, "C") == 0)     p->c = atof(val);
+    else if (strcmp(key, "esr") == 0)   p->esr = atof(val);
+    else if (strcmp(key, "vin") == 0)   p->vin = atof(val);
+    else if (strcmp(key, "r") == 0)     p->rLoad = atof(val);
+    else if (strcmp(key, "i") == 0)     p->iLoad = atof(val);
+    else if (strcmp(key, "vref") == 0)  p->vref = atof(val);
+    else if (strcmp(key, "vgain") == 0) p->vGain = atof(val);
+    else if (strcmp(key, "igain") == 0) p->iGain = atof(val);
+    else if (strcmp(key, "noise") == 0) p->noise = atoi(val);
+    else if (strcmp(key, "itrip") == 0) p->iTrip = atof(val);
+    else if (strcmp(key, "fault") == 0) p->fault = atoi(val);
+    else if (strcmp(key, "temp") == 0)  p->temp = atof(val);
+    else return false;
+
+    return (p->l > 0.0) && (p->c > 0.0);
+}
+
+bool PLANT_ParseEvent(const char *spec)
+{
+    char key[16];
+    char *end;
+    const char *eq;
+    double time = strtod(spec, &end);
+    PLANT_EVENT_KIND kind;
+    size_t len;
+
+    if (end == spec || *end != ':')
+        return false;
+    spec = end + 1;
+    eq = strchr(spec, '=');
+    if (eq == NULL || (len = (size_t)(eq - spec)) >= sizeof(key))
+        return false;
+    memcpy(key, spec, len);
+    key[len] = '\0';
+    if (!_ParseKind(key, &kind))
+        return false;
+    return PLANT_AddEvent(time, kind, atof(eq + 1));
+}
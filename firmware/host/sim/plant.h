@@ -0,0 +1,116 @@
+//--------------------------------------------------------
+//      plant.h
+//--------------------------------------------------------
+//	Description :	Modèle du convertisseur DC-DC (buck ou boost)
+//                  Etat : courant inductance iL, tension condensateur vC.
+//                  Chaque intervalle à topologie constante est linéaire
+//                  et intégré exactement (exponentielle de matrice 2x2
+//                  en forme fermée) : un pas par intervalle, quelle que
+//                  soit la raideur du circuit.
+//
+//  Modèles :
+//      PLANT_SWITCHED : intervalles ON (d.T) puis OFF, diode de roue
+//                       libre (iL >= 0, conduction discontinue)
+//      PLANT_AVERAGED : modèle moyen sur la période
+//
+//  Charge : résistance rLoad en parallèle avec un courant iLoad
+//
+//  Défaut : l'entrée OCFA de la carte est active si le pic de iL dépasse
+//  iTrip (comparateur matériel) ou si un défaut externe est forcé
+//--------------------------------------------------------
+
+#ifndef PLANT_H
+#define PLANT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef enum
+{
+    PLANT_BUCK = 0,
+    PLANT_BOOST
+} PLANT_TOPOLOGY;
+
+typedef enum
+{
+    PLANT_SWITCHED = 0,
+    PLANT_AVERAGED
+} PLANT_MODEL;
+
+typedef struct
+{
+    PLANT_TOPOLOGY topology;
+    PLANT_MODEL model;
+    double  l;          // Inductance (H)
+    double  rl;         // Résistance série de l'inductance (ohm)
+    double  c;          // Capacité de sortie (F)
+    double  esr;        // ESR du condensateur (ohm)
+    double  vin;        // Tension d'entrée (V)
+    double  rLoad;      // Charge résistive (ohm, <= 0 : à vide)
+    double  iLoad;      // Charge courant constant (A)
+
+    // Chaîne de mesure (identique à la carte)
+    double  vref;       // Référence ADC (V)
+    double  vGain;      // Rapport du diviseur Vout -> AN11
+    double  iGain;      // Iout -> tension AN12 (V/A)
+    int     noise;      // Bruit ADC crête (LSB)
+
+    // Entrée de défaut OCFA
+    double  iTrip;      // Seuil du comparateur sur iL (A, <= 0 : absent)
+    int     fault;      // Défaut externe forcé (0 / 1)
+
+    // Carte (capteurs I2C)
+    double  temp;       // Température de la carte (°C, LM92)
+} PLANT_PARAM;
+
+typedef struct
+{
+    double  iL;         // Courant inductance (A)
+    double  vC;         // Tension condensateur (V)
+    double  vOut;       // Tension de sortie aux bornes de la charge (V)
+    double  iOut;       // Courant de charge (A)
+    double  iPeak;      // Maximum de iL sur le dernier PLANT_Advance (A)
+    double  time;       // Temps simulé (s)
+} PLANT_STATE;
+
+// Changement de consigne programmé (échelon de charge, variation Vin)
+typedef enum
+{
+    PLANT_EV_VIN = 0,
+    PLANT_EV_RLOAD,
+    PLANT_EV_ILOAD,
+    PLANT_EV_FAULT,
+    PLANT_EV_TEMP
+} PLANT_EVENT_KIND;
+
+typedef struct
+{
+    double  time;
+    PLANT_EVENT_KIND kind;
+    double  value;
+} PLANT_EVENT;
+
+#define PLANT_EVENT_MAX     32
+
+void    PLANT_DefaultParam(PLANT_PARAM *p);
+void    PLANT_Init(const PLANT_PARAM *p);
+bool    PLANT_AddEvent(double time, PLANT_EVENT_KIND kind, double value);
+bool    PLANT_ParseSet(PLANT_PARAM *p, const char *keyValue);
+bool    PLANT_ParseEvent(const char *spec);
+
+// Avance de dt à partir de la phase donnée dans la période PWM courante
+// (l'intervalle ne doit pas franchir la fin de période) ; retourne vrai
+// si un événement programmé a été appliqué
+bool    PLANT_Advance(double duty, double phase, double dt, double period);
+
+const PLANT_STATE *PLANT_State(void);
+const PLANT_PARAM *PLANT_Param(void);
+
+// Codes ADC 10 bits présents sur AN11 (Vout) et AN12 (Iout)
+uint16_t PLANT_VoutCode(void);
+uint16_t PLANT_IoutCode(void);
+
+// Niveau de l'entrée OCFA (vrai : défaut présent)
+bool     PLANT_FaultInput(void);
+
+#endif
@@ -0,0 +1,790 @@
+//--------------------------------------------------------
+//      tp4_telem.c
+//--------------------------------------------------------
+//	Description :	Décodage et enregistrement de la télémétrie UART1
+//                  du firmware (format : voir ../src/telem.h)
+//
+//  Source : port série (configuré en brut au débit -b), fichier de
+//  capture (tp4_host -u, enregistrement d'un terminal) ou entrée
+//  standard ; un enregistrement .tp4t est relu directement (mmap).
+//
+//  Chaîne : lecture par blocs de TP4T_READ octets, découpe sur les
+//  délimiteurs 0x00, décodage COBS sur place dans le tampon de lecture,
+//  vérification du CRC, puis recopie champ par champ des échantillons
+//  dans des colonnes (un tableau par variable). Aucune allocation par
+//  trame ; le coût est dominé par la lecture et l'écriture des sorties.
+//
+//  Echantillons :
+//      - ignorés tant qu'aucune trame INFO n'a donné les échelles
+//        (moins d'une seconde de flux, TELEM_INFO_FRAMES) ;
+//      - numérotés depuis le premier échantillon retenu ; un numéro de
+//        pas manquant (anneau plein dans le firmware, trame rejetée)
+//        compte comme trou et avance le numéro. Une interruption de plus
+//        de 65536 pas n'est pas détectable (numéro sur 16 bits).
+//
+//  Enregistrement .tp4t (petit-boutiste, hôte petit-boutiste) :
+//      en-tête TP4T_HEADER (64 octets, voir TP4T_HEADER), puis blocs de
+//      TP4T_BLOCK échantillons rangés en colonnes (TP4T_COLUMNS) ; le
+//      dernier bloc est complété par des zéros, header.samples donne le
+//      nombre utile. Lecture numpy :
+//          h = 64; n = 4096
+//          blk = np.dtype([('step','<u4',n), ('integ','<u4',n),
+//                          ('vout','<u2',n), ('iout','<u2',n),
+//                          ('duty','<u2',n), ('flags','<u2',n)])
+//          b = np.memmap(f, blk, 'r', offset=h)
+//
+//  Usage : tp4_telem [options] source
+//      -b baud         débit du port série (défaut TELEM_BAUD)
+//      -o fichier      échantillons en CSV ('-' : sortie standard)
+//      -w fichier      enregistrement .tp4t (fichier ordinaire)
+//      -n n            arrêt après n échantillons
+//  Bilan sur la sortie d'erreur ; Ctrl-C termine proprement une capture.
+//--------------------------------------------------------
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "telem.h"
+
+#define TP4T_READ           (1u << 20)  // Octets par lecture
+#define TP4T_BLOCK          4096        // Echantillons par bloc
+#define TP4T_VERSION        1
+#define TP4T_MAGIC          "TP4TELEM"
+
+#define FRAME_HEADER        4
+#define FRAME_INFO_LEN      23
+#define FRAME_MAX           (FRAME_HEADER + 255 * TELEM_SAMPLE_SIZE + 2)
+
+// Bits de TP4T_COLUMNS.flags (TELEM_FLAG_xxx ramenés en poids faible)
+#define TP4T_FLAG_RAMP      0x0001
+#define TP4T_FLAG_ILIM      0x0002
+#define TP4T_FLAG_FAULT     0x0004
+
+typedef struct
+{
+    char     magic[8];          // TP4T_MAGIC
+    uint16_t version;           // TP4T_VERSION
+    uint16_t headerSize;        // sizeof(TP4T_HEADER)
+    uint32_t blockSamples;      // TP4T_BLOCK
+    uint64_t samples;           // Echantillons utiles
+    uint64_t missing;           // Pas manquants (trous)
+    float    sampleHz;
+    float    lsbVout;
+    float    lsbIout;
+    uint16_t dutyFull;
+    uint8_t  integFormat;       // TELEM_INTEG_xxx
+    uint8_t  reserved0;
+    uint32_t ilimCount;         // Impulsions tronquées (dernière INFO)
+    uint16_t ilimmA;            // Seuil crête de la limitation (dernière INFO)
+    uint8_t  reserved[10];
+} TP4T_HEADER;
+
+// Un bloc : colonnes contiguës, alignées
+typedef struct
+{
+    uint32_t step[TP4T_BLOCK];  // Numéro de pas depuis le début
+    uint32_t integ[TP4T_BLOCK]; // Voir TELEM_INTEG_xxx
+    uint16_t vOut[TP4T_BLOCK];  // Code AN11
+    uint16_t iOut[TP4T_BLOCK];  // Code AN12
+    uint16_t duty[TP4T_BLOCK];  // OC1RS
+    uint16_t flags[TP4T_BLOCK]; // TP4T_FLAG_xxx
+} TP4T_COLUMNS;
+
+typedef char TP4T_HEADER_SIZE_CHECK[sizeof(TP4T_HEADER) == 64 ? 1 : -1];
+typedef char TP4T_BLOCK_SIZE_CHECK[sizeof(TP4T_COLUMNS) == 16 * TP4T_BLOCK ? 1 : -1];
+
+typedef struct
+{
+    uint64_t bytes;             // Octets lus
+    uint64_t frames;            // Trames valides
+    uint64_t infoFrames;
+    uint64_t crcErrors;
+    uint64_t formatErrors;      // COBS, longueur, type inconnu
+    uint64_t skipped;           // Echantillons avant la première INFO
+    uint64_t samples;
+    uint64_t gaps;
+    uint64_t missing;
+    uint16_t fwDropFirst;       // Compteur de pertes du firmware
+    uint16_t fwDropLast;
+    bool     fwDropSeen;
+} DECODE_STATS;
+
+// Résumé des échantillons retenus
+typedef struct
+{
+    uint64_t n;
+    uint64_t flagCount[3];      // Rampe, limitation, défaut
+    uint64_t vSum, iSum;
+    uint16_t vMin, vMax, iMin, iMax, dMin, dMax;
+} SUMMARY;
+
+typedef struct
+{
+    TP4T_HEADER  header;        // Echelles (trame INFO) et compteurs
+    bool         haveInfo;
+    uint16_t     seqNext;       // Numéro de pas attendu
+    uint64_t     step;
+    TP4T_COLUMNS cols;          // Bloc en cours de remplissage
+    uint32_t     fill;
+    FILE        *csv;
+    FILE        *rec;
+    uint64_t     limit;         // 0 : sans limite
+    DECODE_STATS st;
+    SUMMARY      sum;
+} DECODER;
+
+static uint16_t crcTable[256];
+static volatile sig_atomic_t stopRequest;
+
+//------------------------------------------------------------------------------
+// CRC-16/CCITT-FALSE (même polynôme que telem.c)
+
+static void _CrcInit(void)
+{
+    unsigned i, b;
+
+    for (i = 0; i < 256; i++)
+    {
+        uint16_t c = (uint16_t)(i << 8);
+        for (b = 0; b < 8; b++)
+            c = (c & 0x8000) ? (uint16_t)((c << 1) ^ 0x1021) : (uint16_t)(c << 1);
+        crcTable[i] = c;
+    }
+}
+
+static uint16_t _Crc(const uint8_t *p, size_t n)
+{
+    uint16_t c = 0xFFFF;
+
+    while (n--)
+        c = (uint16_t)(c << 8) ^ crcTable[(uint8_t)(c >> 8) ^ *p++];
+    return c;
+}
+
+static inline uint16_t _Get16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t _Get32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16)
+           | ((uint32_t)p[3] << 24);
+}
+
+static inline float _GetFloat(const uint8_t *p)
+{
+    union { uint32_t u; float f; } v;
+
+    v.u = _Get32(p);
+    return v.f;
+}
+
+//------------------------------------------------------------------------------
+// COBS sur place : la trame décodée est plus courte que la trame codée.
+// Retourne la longueur décodée, -1 si la trame est incohérente.
+
+static long _CobsDecode(uint8_t *buf, size_t len)
+{
+    size_t in = 0, out = 0;
+
+    while (in < len)
+    {
+        uint8_t code = buf[in++];
+
+        if (code == 0 || in + code - 1 > len)
+            return -1;
+        memmove(buf + out, buf + in, code - 1u);
+        out += code - 1u;
+        in += code - 1u;
+        if (code != 0xFF && in < len)
+            buf[out++] = 0;
+    }
+    return (long)out;
+}
+
+//------------------------------------------------------------------------------
+// Sorties
+
+static void _CsvHeader(const DECODER *d)
+{
+    fprintf(d->csv, "step,t_s,vout_code,vout_V,iout_code,iout_A,duty,duty_pct,%s,ramp,ilim,fault\n",
+            (d->header.integFormat & TELEM_INTEG_OUTPUT) ? "output" : "integ");
+}
+
+// Bloc de n échantillons en CSV (colonnes d'un bloc en mémoire ou mappé)
+static void _CsvBlock(FILE *csv, const TP4T_HEADER *h, const TP4T_COLUMNS *c, uint32_t n)
+{
+    double dt = h->sampleHz > 0.0f ? 1.0 / h->sampleHz : 0.0;
+    double dutyPct = h->dutyFull ? 100.0 / h->dutyFull : 0.0;
+    uint32_t k;
+
+    for (k = 0; k < n; k++)
+    {
+        double integ;
+
+        if (h->integFormat & TELEM_INTEG_FLOAT)
+        {
+            union { uint32_t u; float f; } v;
+            v.u = c->integ[k];
+            integ = v.f;
+        }
+        else
+            integ = (int32_t)c->integ[k] / 2147483648.0;
+
+        fprintf(csv, "%u,%.6f,%u,%.4f,%u,%.4f,%u,%.3f,%.7g,%u,%u,%u\n",
+                c->step[k], c->step[k] * dt,
+                c->vOut[k], c->vOut[k] * h->lsbVout,
+                c->iOut[k], c->iOut[k] * h->lsbIout,
+                c->duty[k], c->duty[k] * dutyPct, integ,
+                (c->flags[k] & TP4T_FLAG_RAMP) != 0,
+                (c->flags[k] & TP4T_FLAG_ILIM) != 0,
+                (c->flags[k] & TP4T_FLAG_FAULT) != 0);
+    }
+}
+
+static void _Summarize(SUMMARY *s, const TP4T_COLUMNS *c, uint32_t n)
+{
+    uint32_t k;
+
+    for (k = 0; k < n; k++)
+    {
+        if (s->n++ == 0)
+        {
+            s->vMin = s->vMax = c->vOut[k];
+            s->iMin = s->iMax = c->iOut[k];
+            s->dMin = s->dMax = c->duty[k];
+        }
+        if (c->vOut[k] < s->vMin) s->vMin = c->vOut[k];
+        if (c->vOut[k] > s->vMax) s->vMax = c->vOut[k];
+        if (c->iOut[k] < s->iMin) s->iMin = c->iOut[k];
+        if (c->iOut[k] > s->iMax) s->iMax = c->iOut[k];
+        if (c->duty[k] < s->dMin) s->dMin = c->duty[k];
+        if (c->duty[k] > s->dMax) s->dMax = c->duty[k];
+        s->vSum += c->vOut[k];
+        s->iSum += c->iOut[k];
+        s->flagCount[0] += (c->flags[k] & TP4T_FLAG_RAMP) != 0;
+        s->flagCount[1] += (c->flags[k] & TP4T_FLAG_ILIM) != 0;
+        s->flagCount[2] += (c->flags[k] & TP4T_FLAG_FAULT) != 0;
+    }
+}
+
+// Bloc en cours vers les sorties ; le dernier est complété par des zéros
+static int _Flush(DECODER *d)
+{
+    if (d->fill == 0)
+        return 0;
+    _Summarize(&d->sum, &d->cols, d->fill);
+    if (d->csv != NULL)
+        _CsvBlock(d->csv, &d->header, &d->cols, d->fill);
+    if (d->rec != NULL)
+    {
+        if (d->fill < TP4T_BLOCK)
+        {
+            uint32_t r = TP4T_BLOCK - d->fill;
+            memset(&d->cols.step[d->fill], 0, r * sizeof(uint32_t));
+            memset(&d->cols.integ[d->fill], 0, r * sizeof(uint32_t));
+            memset(&d->cols.vOut[d->fill], 0, r * sizeof(uint16_t));
+            memset(&d->cols.iOut[d->fill], 0, r * sizeof(uint16_t));
+            memset(&d->cols.duty[d->fill], 0, r * sizeof(uint16_t));
+            memset(&d->cols.flags[d->fill], 0, r * sizeof(uint16_t));
+        }
+        if (fwrite(&d->cols, sizeof(d->cols), 1, d->rec) != 1)
+            return -1;
+    }
+    d->fill = 0;
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Trames décodées
+
+static void _Info(DECODER *d, const uint8_t *r)
+{
+    TP4T_HEADER *h = &d->header;
+    float hz = (float)_Get16(r + 2);
+    float lv = _GetFloat(r + 4), li = _GetFloat(r + 8);
+    uint16_t full = _Get16(r + 12);
+    uint16_t ilimmA = _Get16(r + 15);
+
+    d->st.infoFrames++;
+    if (r[1] != TELEM_VERSION)
+    {
+        d->st.formatErrors++;
+        return;
+    }
+    // Limitation de courant : seuil modifiable en marche, compteur croissant
+    if (d->haveInfo && ilimmA != h->ilimmA)
+        fprintf(stderr, "current limit: %.3f A -> %.3f A after %llu samples\n",
+                h->ilimmA * 1e-3, ilimmA * 1e-3, (unsigned long long)d->st.samples);
+    h->ilimmA = ilimmA;
+    h->ilimCount = _Get32(r + 17);
+    if (d->haveInfo)
+    {
+        if (hz != h->sampleHz || lv != h->lsbVout || li != h->lsbIout
+            || full != h->dutyFull || r[14] != h->integFormat)
+            fprintf(stderr, "warning: scales changed after %llu samples, kept the first ones\n",
+                    (unsigned long long)d->st.samples);
+        return;
+    }
+    h->sampleHz = hz;
+    h->lsbVout = lv;
+    h->lsbIout = li;
+    h->dutyFull = full;
+    h->integFormat = r[14];
+    d->haveInfo = true;
+    if (d->csv != NULL)
+        _CsvHeader(d);
+}
+
+static int _Samples(DECODER *d, const uint8_t *r, uint8_t n)
+{
+    const uint8_t *p = r + FRAME_HEADER;
+    uint8_t k;
+
+    if (!d->st.fwDropSeen)
+    {
+        d->st.fwDropFirst = _Get16(r + 2);
+        d->st.fwDropSeen = true;
+    }
+    d->st.fwDropLast = _Get16(r + 2);
+
+    if (!d->haveInfo)
+    {
+        d->st.skipped += n;
+        return 0;
+    }
+    for (k = 0; k < n; k++, p += TELEM_SAMPLE_SIZE)
+    {
+        uint16_t seq = _Get16(p);
+        uint16_t vOut = _Get16(p + 2);
+        uint32_t f = d->fill;
+
+        if (d->st.samples == 0)
+            d->seqNext = seq;
+        if (seq != d->seqNext)
+        {
+            uint16_t gap = (uint16_t)(seq - d->seqNext);
+            d->st.gaps++;
+            d->st.missing += gap;
+            d->step += gap;
+        }
+        d->seqNext = seq + 1;
+
+        d->cols.step[f] = (uint32_t)d->step++;
+        d->cols.vOut[f] = vOut & TELEM_CODE_MASK;
+        d->cols.iOut[f] = _Get16(p + 4);
+        d->cols.duty[f] = _Get16(p + 6);
+        d->cols.integ[f] = _Get32(p + 8);
+        d->cols.flags[f] = ((vOut & TELEM_FLAG_RAMP) ? TP4T_FLAG_RAMP : 0)
+                         | ((vOut & TELEM_FLAG_ILIM) ? TP4T_FLAG_ILIM : 0)
+                         | ((vOut & TELEM_FLAG_FAULT) ? TP4T_FLAG_FAULT : 0);
+        d->st.samples++;
+        if (++d->fill == TP4T_BLOCK && _Flush(d) != 0)
+            return -1;
+        if (d->limit != 0 && d->st.samples >= d->limit)
+        {
+            stopRequest = 1;
+            break;
+        }
+    }
+    return 0;
+}
+
+// Trame COBS sans son délimiteur, décodée sur place ; une trame rejetée
+// n'est comptée en erreur que si son début est sûr (countErrors)
+static int _Frame(DECODER *d, uint8_t *f, size_t len, bool countErrors)
+{
+    long n = _CobsDecode(f, len);
+
+    if (n < FRAME_HEADER)
+    {
+        d->st.formatErrors += countErrors;
+        return 0;
+    }
+    if (_Crc(f, (size_t)n - 2) != _Get16(f + n - 2))
+    {
+        d->st.crcErrors += countErrors;
+        return 0;
+    }
+    if (f[0] == TELEM_FRAME_SAMPLES && n == FRAME_HEADER + f[1] * TELEM_SAMPLE_SIZE + 2)
+    {
+        d->st.frames++;
+        return _Samples(d, f, f[1]);
+    }
+    if (f[0] == TELEM_FRAME_INFO && n == FRAME_INFO_LEN)
+    {
+        d->st.frames++;
+        _Info(d, f);
+        return 0;
+    }
+    d->st.formatErrors += countErrors;
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Flux brut : le début, jusqu'au premier délimiteur, peut être une fin de
+// trame prise en cours (port ouvert pendant l'émission) ; il est décodé
+// sans compter d'erreur s'il est rejeté. Même chose après une resynchro.
+
+static int _DecodeStream(DECODER *d, int fd)
+{
+    uint8_t *buf = malloc(TP4T_READ + FRAME_MAX);
+    size_t keep = 0;
+    bool synced = false;
+    int rc = 0;
+
+    if (buf == NULL)
+        return -1;
+    while (!stopRequest)
+    {
+        ssize_t got = read(fd, buf + keep, TP4T_READ);
+        uint8_t *p = buf, *end;
+
+        if (got < 0 && errno == EINTR)
+            continue;
+        if (got < 0)
+        {
+            perror("read");
+            rc = -1;
+            break;
+        }
+        if (got == 0)
+            break;
+        d->st.bytes += (uint64_t)got;
+        end = buf + keep + got;
+
+        while (p < end && !stopRequest)
+        {
+            uint8_t *z = memchr(p, 0, (size_t)(end - p));
+
+            if (z == NULL)
+                break;
+            if (z > p && _Frame(d, p, (size_t)(z - p), synced) != 0)
+            {
+                rc = -1;
+                stopRequest = 1;
+            }
+            synced = true;
+            p = z + 1;
+        }
+        // Trame incomplète : reportée en tête du tampon, sauf si trop longue
+        keep = (size_t)(end - p);
+        if (keep > FRAME_MAX)
+        {
+            if (synced)
+                d->st.formatErrors++;
+            keep = 0;
+            synced = false;
+        }
+        memmove(buf, p, keep);
+    }
+    free(buf);
+    return rc;
+}
+
+//------------------------------------------------------------------------------
+// Enregistrement .tp4t relu en place
+
+static int _DecodeRecord(DECODER *d, const char *path)
+{
+    int fd = open(path, O_RDONLY);
+    struct stat sb;
+    const uint8_t *base;
+    const TP4T_HEADER *h;
+    uint64_t left, blocks, b;
+
+    if (fd < 0 || fstat(fd, &sb) != 0)
+    {
+        perror(path);
+        return -1;
+    }
+    base = mmap(NULL, (size_t)sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+    {
+        perror(path);
+        return -1;
+    }
+    // En-tête complet avant toute lecture ; blocs bornés par la taille du
+    // fichier (header.samples peut être corrompu)
+    h = (const TP4T_HEADER *)base;
+    if ((uint64_t)sb.st_size < sizeof(TP4T_HEADER)
+        || h->version != TP4T_VERSION || h->headerSize != sizeof(TP4T_HEADER)
+        || h->blockSamples != TP4T_BLOCK
+        || h->samples / TP4T_BLOCK + (h->samples % TP4T_BLOCK != 0)
+           > ((uint64_t)sb.st_size - sizeof(TP4T_HEADER)) / sizeof(TP4T_COLUMNS))
+    {
+        fprintf(stderr, "%s: unsupported or truncated recording\n", path);
+        munmap((void *)base, (size_t)sb.st_size);
+        return -1;
+    }
+    madvise((void *)base, (size_t)sb.st_size, MADV_SEQUENTIAL);
+    blocks = (h->samples + TP4T_BLOCK - 1) / TP4T_BLOCK;
+
+    d->header = *h;
+    d->haveInfo = true;
+    d->st.bytes = (uint64_t)sb.st_size;
+    d->st.missing = h->missing;
+    if (d->csv != NULL)
+        _CsvHeader(d);
+
+    left = d->limit != 0 && d->limit < h->samples ? d->limit : h->samples;
+    for (b = 0; b < blocks && left != 0 && !stopRequest; b++)
+    {
+        const TP4T_COLUMNS *c = (const TP4T_COLUMNS *)(base + sizeof(TP4T_HEADER)) + b;
+        uint32_t n = left < TP4T_BLOCK ? (uint32_t)left : TP4T_BLOCK;
+
+        _Summarize(&d->sum, c, n);
+        if (d->csv != NULL)
+            _CsvBlock(d->csv, h, c, n);
+        d->st.samples += n;
+        left -= n;
+    }
+    munmap((void *)base, (size_t)sb.st_size);
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Source
+
+static speed_t _Speed(long baud)
+{
+    static const struct { long baud; speed_t speed; } table[] =
+    {
+        { 115200, B115200 }, { 230400, B230400 }, { 460800, B460800 },
+        { 921600, B921600 }, { 1000000, B1000000 }, { 1500000, B1500000 },
+        { 2000000, B2000000 }, { 3000000, B3000000 }
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(table) / sizeof(table[0]); i++)
+    {
+        if (table[i].baud == baud)
+            return table[i].speed;
+    }
+    return B0;
+}
+
+// Port série : brut, 8N1, lecture bloquante
+static int _SerialSetup(int fd, long baud)
+{
+    struct termios tio;
+    speed_t speed = _Speed(baud);
+
+    if (speed == B0)
+    {
+        fprintf(stderr, "unsupported baud rate %ld\n", baud);
+        return -1;
+    }
+    if (tcgetattr(fd, &tio) != 0)
+    {
+        perror("tcgetattr");
+        return -1;
+    }
+    cfmakeraw(&tio);
+    tio.c_cflag |= CLOCAL | CREAD;
+    tio.c_cflag &= ~(CSTOPB | PARENB | CRTSCTS);
+    tio.c_cc[VMIN] = 1;
+    tio.c_cc[VTIME] = 0;
+    cfsetispeed(&tio, speed);
+    cfsetospeed(&tio, speed);
+    if (tcsetattr(fd, TCSANOW, &tio) != 0)
+    {
+        perror("tcsetattr");
+        return -1;
+    }
+    tcflush(fd, TCIFLUSH);
+    return 0;
+}
+
+static bool _IsRecord(const char *path)
+{
+    char magic[sizeof(TP4T_MAGIC) - 1];
+    FILE *f = fopen(path, "rb");
+    bool is;
+
+    if (f == NULL)
+        return false;
+    is = fread(magic, sizeof(magic), 1, f) == 1 && memcmp(magic, TP4T_MAGIC, sizeof(magic)) == 0;
+    fclose(f);
+    return is;
+}
+
+static void _Stop(int sig)
+{
+    (void)sig;
+    stopRequest = 1;
+}
+
+static double _Seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void _Report(const DECODER *d, double wall)
+{
+    const DECODE_STATS *st = &d->st;
+    const SUMMARY *s = &d->sum;
+    const TP4T_HEADER *h = &d->header;
+
+    fprintf(stderr, "read %llu bytes in %.3f s (%.1f MB/s), %llu samples (%.1f M/s)\n",
+            (unsigned long long)st->bytes, wall, wall > 0.0 ? st->bytes / wall * 1e-6 : 0.0,
+            (unsigned long long)st->samples, wall > 0.0 ? st->samples / wall * 1e-6 : 0.0);
+    if (st->frames != 0 || st->crcErrors != 0 || st->formatErrors != 0)
+        fprintf(stderr, "frames: %llu valid (%llu info), %llu CRC errors, %llu malformed, "
+                        "%llu samples before info\n",
+                (unsigned long long)st->frames, (unsigned long long)st->infoFrames,
+                (unsigned long long)st->crcErrors, (unsigned long long)st->formatErrors,
+                (unsigned long long)st->skipped);
+    fprintf(stderr, "gaps: %llu, %llu missing steps", (unsigned long long)st->gaps,
+            (unsigned long long)st->missing);
+    if (st->fwDropSeen)
+        fprintf(stderr, " (firmware ring overflow: %u)", (uint16_t)(st->fwDropLast - st->fwDropFirst));
+    fprintf(stderr, "\n");
+    if (!d->haveInfo || s->n == 0)
+        return;
+    fprintf(stderr, "%.0f Hz, %.3f s: Vout %.3f..%.3f V (mean %.3f), Iout %.3f..%.3f A "
+                    "(mean %.3f), duty %.1f..%.1f %%\n",
+            h->sampleHz, (st->samples + st->missing) / h->sampleHz,
+            s->vMin * h->lsbVout, s->vMax * h->lsbVout, (double)s->vSum / s->n * h->lsbVout,
+            s->iMin * h->lsbIout, s->iMax * h->lsbIout, (double)s->iSum / s->n * h->lsbIout,
+            h->dutyFull ? s->dMin * 100.0 / h->dutyFull : 0.0,
+            h->dutyFull ? s->dMax * 100.0 / h->dutyFull : 0.0);
+    fprintf(stderr, "flags: %llu ramp, %llu current limit, %llu fault\n",
+            (unsigned long long)s->flagCount[0], (unsigned long long)s->flagCount[1],
+            (unsigned long long)s->flagCount[2]);
+    fprintf(stderr, "current limit: %.3f A peak, %lu truncated pulses (last info)\n",
+            h->ilimmA * 1e-3, (unsigned long)h->ilimCount);
+}
+
+static void _Usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-b baud] [-o out.csv] [-w out.tp4t] [-n samples] source\n"
+                    "       source: serial port, raw capture, .tp4t recording or '-'\n", name);
+}
+
+int main(int argc, char **argv)
+{
+    static DECODER d;
+    const char *csvPath = NULL, *recPath = NULL, *src;
+    long baud = TELEM_BAUD;
+    struct sigaction sa;
+    double t0;
+    int opt, fd, rc;
+
+    while ((opt = getopt(argc, argv, "b:o:w:n:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'b': baud = atol(optarg); break;
+            case 'o': csvPath = optarg; break;
+            case 'w': recPath = optarg; break;
+            case 'n': d.limit = strtoull(optarg, NULL, 0); break;
+            default:
+                _Usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+    if (optind != argc - 1)
+    {
+        _Usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    src = argv[optind];
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = _Stop;              // Sans SA_RESTART : read() interrompu
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    _CrcInit();
+
+    if (csvPath != NULL)
+    {
+        d.csv = strcmp(csvPath, "-") == 0 ? stdout : fopen(csvPath, "w");
+        if (d.csv == NULL)
+        {
+            perror(csvPath);
+            return EXIT_FAILURE;
+        }
+        setvbuf(d.csv, NULL, _IOFBF, 1u << 20);
+    }
+
+    t0 = _Seconds();
+    if (strcmp(src, "-") != 0 && _IsRecord(src))
+    {
+        if (recPath != NULL)
+        {
+            fprintf(stderr, "%s is already a recording\n", src);
+            return EXIT_FAILURE;
+        }
+        rc = _DecodeRecord(&d, src);
+    }
+    else
+    {
+        if (recPath != NULL)
+        {
+            d.rec = fopen(recPath, "wb");
+            if (d.rec == NULL)
+            {
+                perror(recPath);
+                return EXIT_FAILURE;
+            }
+            setvbuf(d.rec, NULL, _IOFBF, 1u << 20);
+            // En-tête provisoire, réécrit à la fin avec les échelles et le total
+            fwrite(&d.header, sizeof(d.header), 1, d.rec);
+        }
+
+        fd = strcmp(src, "-") == 0 ? STDIN_FILENO : open(src, O_RDONLY | O_NOCTTY);
+        if (fd < 0)
+        {
+            perror(src);
+            return EXIT_FAILURE;
+        }
+        if (isatty(fd) && _SerialSetup(fd, baud) != 0)
+            return EXIT_FAILURE;
+        rc = _DecodeStream(&d, fd);
+        if (_Flush(&d) != 0)
+            rc = -1;
+        if (fd != STDIN_FILENO)
+            close(fd);
+
+        if (d.rec != NULL)
+        {
+            memcpy(d.header.magic, TP4T_MAGIC, sizeof(d.header.magic));
+            d.header.version = TP4T_VERSION;
+            d.header.headerSize = sizeof(TP4T_HEADER);
+            d.header.blockSamples = TP4T_BLOCK;
+            d.header.samples = d.st.samples;
+            d.header.missing = d.st.missing;
+            if (fseek(d.rec, 0, SEEK_SET) != 0
+                || fwrite(&d.header, sizeof(d.header), 1, d.rec) != 1)
+            {
+                perror(recPath);
+                rc = -1;
+            }
+            if (fclose(d.rec) != 0)
+                rc = -1;
+        }
+    }
+    if (d.csv != NULL && d.csv != stdout && fclose(d.csv) != 0)
+        rc = -1;
+    else if (d.csv == stdout)
+        fflush(stdout);
+
+    _Report(&d, _Seconds() - t0);
+    return rc == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,211 @@
+//--------------------------------------------------------
+//      tp4_i2ctest.c
+//--------------------------------------------------------
+//	Description :	Essai des fonctions bloquantes de Mc32_I2cUtilCCS,
+//                  puis de l'ordonnanceur du bus I2C1 (i2cbus.c) sur le
+//                  driver statique, sur le bus simulé
+//
+//  Cas vérifiés, chacun par une lecture de l'identifiant de l'INA226
+//  simulé (registre 0xFE = 0x5449) :
+//      blocking  lecture par i2c_start/write/reStart/read/stop
+//      bounded   esclave qui retient SDA : i2c_write abandonne après
+//                I2C_SPIN_MAX lectures d'état et rend false, la suite de
+//                la transaction échoue sans attendre, bus récupéré
+//      ack       lecture acquittée, valeur rendue
+//      nack      adresse absente : fin en erreur, sans timeout
+//      timeout   esclave qui retient SDA au milieu d'une lecture : fin
+//                en erreur après I2CBUS_TIMEOUT_MS, récupération du bus
+//                (impulsions SCL), transaction en attente servie ensuite
+//      recover   lecture acquittée après la récupération
+//
+//  Usage : tp4_i2ctest     code de sortie non nul si un cas échoue
+//--------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_sim.h"
+#include "host_i2c.h"
+#include "host_ina226.h"
+#include "i2cbus.h"
+#include "ina226.h"
+#include "Mc32_I2cUtilCCS.h"
+#include "system_definitions.h"
+
+#define TEST_ABSENT_ADDR    0xA0    // Aucun esclave simulé à cette adresse
+#define TEST_HOLD_PULSES    5       // Fronts SCL avant que l'esclave relâche SDA
+#define TEST_POLL_CYCLES    8       // Un tour de boucle d'attente (PBCLK)
+
+void IntHandlerDrvI2CInstance0(void);
+
+typedef struct
+{
+    uint8_t  tx[1];
+    uint8_t  rx[2];
+    bool     done;
+    bool     ok;
+    double   at;                // Fin de la transaction (s)
+} TEST_READ;
+
+static int8_t client;
+static int failures;
+
+static void _ReadDone(bool ok, uintptr_t context)
+{
+    TEST_READ *r = (TEST_READ *)context;
+
+    r->done = true;
+    r->ok = ok;
+    r->at = HOST_SimSeconds();
+}
+
+static bool _Submit(TEST_READ *r, uint8_t address)
+{
+    r->tx[0] = 0xFE;
+    r->rx[0] = r->rx[1] = 0;
+    r->done = false;
+    return I2CBUS_Read(client, address, r->tx, 1, r->rx, 2, _ReadDone, (uintptr_t)r);
+}
+
+// ms pas de supervision : simulation puis I2CBUS_Tick, comme APP_Supervisor
+static void _Run(unsigned ms)
+{
+    while (ms-- != 0)
+    {
+        HOST_SimAdvance(SYS_CLK_BUS_PERIPHERAL_1 / 1000);
+        I2CBUS_Tick(1);
+    }
+}
+
+// Attente active des fonctions bloquantes : le temps simulé avance
+static void _Poll(void)
+{
+    HOST_SimAdvance(TEST_POLL_CYCLES);
+}
+
+// Registre 0xFE de l'INA226 par les fonctions bloquantes
+static bool _BlockingRead(uint16_t *value)
+{
+    uint8_t hi, lo;
+    bool ok;
+
+    ok = i2c_start() && i2c_write(INA226_ADDR) && i2c_write(0xFE)
+         && i2c_reStart() && i2c_write(INA226_ADDR | 1);
+    hi = i2c_read(true);
+    lo = i2c_read(false);
+    ok = i2c_stop() && ok;
+    *value = ((uint16_t)hi << 8) | lo;
+    return ok && !i2c_timedOut();
+}
+
+static uint16_t _Value(const TEST_READ *r)
+{
+    return ((uint16_t)r->rx[0] << 8) | r->rx[1];
+}
+
+static void _Check(const char *name, bool pass, const char *detail)
+{
+    printf("i2ctest: %-8s %s  %s\n", name, pass ? "ok  " : "FAIL", detail);
+    if (!pass)
+        failures++;
+}
+
+int main(void)
+{
+    I2CBUS_STATS st;
+    TEST_READ a, b;
+    char detail[128];
+    double t0, t1;
+    uint16_t value;
+    uint32_t recoveries;
+    bool ok;
+
+    HOST_SimInit();
+    HOST_Ina226Attach();
+
+    // Fonctions bloquantes, module seul (interruption non utilisée)
+    hostPlib.i2cPoll = _Poll;
+    i2c_init(false);
+    ok = _BlockingRead(&value);
+    snprintf(detail, sizeof(detail), "ok %d value 0x%04X", ok, value);
+    _Check("blocking", ok && value == 0x5449, detail);
+
+    // Esclave bloqué pendant l'octet d'adresse : une seule attente
+    // abandonnée, les appels suivants échouent aussitôt
+    i2c_start();
+    HOST_I2cHoldSda(TEST_HOLD_PULSES);
+    t0 = HOST_SimSeconds();
+    ok = i2c_write(INA226_ADDR);
+    t1 = HOST_SimSeconds();
+    value = i2c_read(false);
+    ok = i2c_stop() || ok;
+    snprintf(detail, sizeof(detail), "ok %d after %.2f ms, then %.2f ms, read 0x%02X, %lu timeouts",
+             ok, (t1 - t0) * 1e3, (HOST_SimSeconds() - t1) * 1e3, value,
+             (unsigned long)i2c_timeoutCount());
+    _Check("bounded", !ok && i2c_timedOut() && i2c_timeoutCount() == 1
+           && (t1 - t0) * 1e3 >= 1.0 && (t1 - t0) * 1e3 <= 3.0
+           && HOST_SimSeconds() == t1 && value == 0xFF, detail);
+    i2c_recoverStart();
+    while (!i2c_recoverStep())
+        HOST_SimAdvance(SYS_CLK_BUS_PERIPHERAL_1 / 100000);
+    ok = _BlockingRead(&value);
+    snprintf(detail, sizeof(detail), "after recovery: ok %d value 0x%04X, SDA %s",
+             ok, value, HOST_I2cStalled() ? "held" : "free");
+    _Check("bounded", ok && value == 0x5449 && !HOST_I2cStalled(), detail);
+    hostPlib.i2cPoll = NULL;
+    recoveries = i2c_recoveryCount();
+
+    // Ordonnanceur sur le driver statique
+    HOST_SimAttachIsr(INT_SOURCE_I2C_1_MASTER, IntHandlerDrvI2CInstance0);
+    HOST_SimAttachIsr(INT_SOURCE_I2C_1_ERROR, IntHandlerDrvI2CInstance0);
+    DRV_I2C0_Initialize();
+    SYS_INT_Enable();
+    I2CBUS_Initialize();
+    client = I2CBUS_ClientAdd(I2CBUS_PRIO_HIGH, 0);
+
+    // Lecture acquittée
+    _Submit(&a, INA226_ADDR);
+    _Run(5);
+    snprintf(detail, sizeof(detail), "done %d ok %d value 0x%04X",
+             a.done, a.ok, _Value(&a));
+    _Check("ack", a.done && a.ok && _Value(&a) == 0x5449, detail);
+
+    // Adresse non acquittée : erreur dès la fin de l'octet d'adresse
+    t0 = HOST_SimSeconds();
+    _Submit(&a, TEST_ABSENT_ADDR);
+    _Run(5);
+    I2CBUS_StatsGet(client, &st);
+    snprintf(detail, sizeof(detail), "done %d ok %d after %.2f ms, errors %lu timeouts %lu",
+             a.done, a.ok, (a.at - t0) * 1e3,
+             (unsigned long)st.errors, (unsigned long)st.timeouts);
+    _Check("nack", a.done && !a.ok && st.errors == 1 && st.timeouts == 0, detail);
+
+    // Esclave bloqué pendant l'octet d'adresse ; une seconde lecture
+    // attend dans la file du client pendant la récupération
+    t0 = HOST_SimSeconds();
+    _Submit(&a, INA226_ADDR);
+    _Submit(&b, INA226_ADDR);
+    HOST_SimAdvance(SYS_CLK_BUS_PERIPHERAL_1 / 10000);
+    HOST_I2cHoldSda(TEST_HOLD_PULSES);
+    _Run(I2CBUS_TIMEOUT_MS + 40);
+    I2CBUS_StatsGet(client, &st);
+    snprintf(detail, sizeof(detail),
+             "done %d ok %d after %.2f ms, timeouts %lu, recoveries %lu, SDA %s",
+             a.done, a.ok, (a.at - t0) * 1e3, (unsigned long)st.timeouts,
+             (unsigned long)(i2c_recoveryCount() - recoveries), HOST_I2cStalled() ? "held" : "free");
+    _Check("timeout", a.done && !a.ok && st.timeouts == 1 && i2c_recoveryCount() == recoveries + 1
+           && !HOST_I2cStalled() && (a.at - t0) * 1e3 >= I2CBUS_TIMEOUT_MS, detail);
+    snprintf(detail, sizeof(detail), "queued read: done %d ok %d value 0x%04X",
+             b.done, b.ok, _Value(&b));
+    _Check("timeout", b.done && b.ok && _Value(&b) == 0x5449, detail);
+
+    // Bus de nouveau utilisable
+    _Submit(&a, INA226_ADDR);
+    _Run(5);
+    I2CBUS_StatsGet(client, &st);
+    snprintf(detail, sizeof(detail), "done %d ok %d value 0x%04X, %lu transfers %lu errors",
+             a.done, a.ok, _Value(&a), (unsigned long)st.transfers, (unsigned long)st.errors);
+    _Check("recover", a.done && a.ok && _Value(&a) == 0x5449, detail);
+
+    printf("i2ctest: %s\n", failures == 0 ? "all passed" : "FAILED");
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
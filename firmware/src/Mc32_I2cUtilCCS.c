@@ -9,17 +9,21 @@
 //	Compilateur	:	XC32 V1.33 & Harmony V1.00
 //  Modifications :
 //  	CHR 19.03.2015  Migration sur plib_i2c de Harmony 1.00   CHR
-//      CHR 12.04.2016  adaptaion dtails pour plib_i2c de Harmony 1.06   CHR
-//		SCA 04.04.2017  Complments commentaires i2c_init HighFrequencyEnable/Disable
+//      CHR 12.04.2016  adaptaion détails pour plib_i2c de Harmony 1.06   CHR
+//		SCA 04.04.2017  Compléments commentaires i2c_init HighFrequencyEnable/Disable
 //  	SCA 18.03.2024  v1.51 MPLABX 5.50/xc32 2.50/Harmony 2.06
 //                   Correction commentaire acknowledge i2c_write()
+//      17.10.2026  v1.60 Attentes bornées (I2C_SPIN_MAX), abandon rendu
+//                   à l'appelant, correction des tests de collision ;
+//                   récupération du bus
 //--------------------------------------------------------
 
 
 #include "app.h"
 #include "Mc32_I2cUtilCCS.h"
-#include "peripheral\i2c\plib_i2c.h"
-#include "peripheral\osc\plib_osc.h"
+#include "peripheral/i2c/plib_i2c.h"
+#include "peripheral/osc/plib_osc.h"
+#include "system_definitions.h"
 
 
 // KIT 32MX795F512L Constants
@@ -27,6 +31,32 @@
 #define I2C_CLOCK_FAST 400000
 #define I2C_CLOCK_SLOW 100000
 
+// Broches du bus (PIC32MX130 : SCL1 = RB8, SDA1 = RB9)
+#define KIT_I2C_PORT        PORT_CHANNEL_B
+#define KIT_I2C_SCL         PORTS_BIT_POS_8
+#define KIT_I2C_SDA         PORTS_BIT_POS_9
+
+// Attente max des fonctions bloquantes : ~2 ms à 48 MHz, un octet à
+// 100 kHz dure 90 us. Au-delà, la fonction abandonne et rend un échec ;
+// les appels suivants de la même transaction retournent tout de suite,
+// jusqu'au prochain i2c_start.
+#define I2C_SPIN_MAX        10000ul
+
+static bool     i2cFailed;          // Attente abandonnée depuis i2c_start
+static uint32_t i2cSpinTimeouts;
+
+#define I2C_WAIT(cond, failResult)                      \
+    do {                                                \
+        uint32_t spin = I2C_SPIN_MAX;                   \
+        while (!(cond)) {                               \
+            if (--spin == 0) {                          \
+                i2cSpinTimeouts++;                      \
+                i2cFailed = true;                       \
+                return failResult;                      \
+            }                                           \
+        }                                               \
+    } while (0)
+
 
 //------------------------------------------------------------------------------
 // i2c_init
@@ -47,8 +77,8 @@ void i2c_init( bool Fast )
     
 	// LOW frequency is enabled (**NOTE** PLIB function logic reverted)
 	// A 100k et 400kHz, on devrait activer le "slope control" 
-	// (cf.  I2C datasheet PIC32). Toutefois, le LM92 a des problmes 
-	// d'incompatibilit avec les flancs trop lents => dsactiv
+	// (cf. § I2C datasheet PIC32). Toutefois, le LM92 a des problèmes 
+	// d'incompatibilité avec les flancs trop lents => désactivé
 	// Voir application note 
 	// "AN-2113 Applying I2C Compatible Temperature Sensors in Systems with Slow Clock Edges"
     PLIB_I2C_HighFrequencyEnable(KIT_I2C_BUS);
@@ -75,16 +105,19 @@ void i2c_init( bool Fast )
 //------------------------------------------------------------------------------
 // i2c_start()
 //
-// Dbute la transaction I2C master
+// Débute la transaction I2C master
+// Valeur de retour : false si le bus n'est jamais devenu libre
 //
 // Adaptation plib_i2c  : 19.03.2015 CHR
 
-void i2c_start(void)
+bool i2c_start(void)
 {
     // int DebugCode = 0;
 
+    i2cFailed = false;
+
     // Wait for the bus to be idle, then start the transfer
-    while(PLIB_I2C_BusIsIdle(KIT_I2C_BUS) == false);
+    I2C_WAIT(PLIB_I2C_BusIsIdle(KIT_I2C_BUS), false);
 
      /* Check for recieve overflow */
     if ( PLIB_I2C_ReceiverOverflowHasOccurred(KIT_I2C_BUS))
@@ -100,7 +133,7 @@ void i2c_start(void)
 
     PLIB_I2C_MasterStart(KIT_I2C_BUS);
 
-    if (PLIB_I2C_ArbitrationLossHasOccurred(KIT_I2C_BUS));
+    if (PLIB_I2C_ArbitrationLossHasOccurred(KIT_I2C_BUS))
     {
         // DBPRINTF("Error: Bus collision during transfer Start\n");
         // DebugCode = 1;
@@ -109,8 +142,9 @@ void i2c_start(void)
     }
    
     // Wait for the signal to complete
-     while (!PLIB_I2C_BusIsIdle(KIT_I2C_BUS));
-   
+    I2C_WAIT(PLIB_I2C_BusIsIdle(KIT_I2C_BUS), false);
+
+    return true;
  } // end i2c_start
 
 
@@ -118,11 +152,16 @@ void i2c_start(void)
 // i2c_reStart()
 //
 // Start en milieu de trame I2C master
+// Valeur de retour : false si la transaction a déjà échoué ou si le
+//  restart ne se termine pas
 
-void i2c_reStart(void)
+bool i2c_reStart(void)
 {
    // int DebugCode = 0;
-  
+
+   if (i2cFailed)
+       return false;
+
    // Pas d'attente bus en Idle
 
    /* Check for recieve overflow */
@@ -140,7 +179,7 @@ void i2c_reStart(void)
    // PLIB_I2C_StartClear(KIT_I2C_BUS);
    PLIB_I2C_MasterStartRepeat(KIT_I2C_BUS);
    
-   if (PLIB_I2C_ArbitrationLossHasOccurred(KIT_I2C_BUS));
+   if (PLIB_I2C_ArbitrationLossHasOccurred(KIT_I2C_BUS))
     {
         // DBPRINTF("Error: Bus collision during transfer Start\n");
         // DebugCode = 1;
@@ -149,9 +188,9 @@ void i2c_reStart(void)
     }
     
    // Wait for the signal to complete
-   while (!PLIB_I2C_BusIsIdle(KIT_I2C_BUS));
+   I2C_WAIT(PLIB_I2C_BusIsIdle(KIT_I2C_BUS), false);
 
-  
+   return true;
 } // end i2c_reStart
 
 
@@ -159,12 +198,13 @@ void i2c_reStart(void)
 // i2c_write()
 //
 // Syntaxe : 	i2c_write (data);
-// En mode matre, la fonction gnre le signal d'horloge, 
-//  en mode esclave elle attend le signal d'horloge du matre.
-// Paramtre data : la valeur 8 bits  transmettre.
-// Valeur de retour : acknowledge donn par l'autre partie
-//  false : l'autre partie n'a pas quittanc le byte transmis,
-//  true  : l'autre partie a quittanc le byte transmis.
+// En mode maître, la fonction génère le signal d'horloge, 
+//  en mode esclave elle attend le signal d'horloge du maître.
+// Paramètre data : la valeur 8 bits à transmettre.
+// Valeur de retour : acknowledge donné par l'autre partie
+//  false : l'autre partie n'a pas quittancé le byte transmis,
+//  true  : l'autre partie a quittancé le byte transmis.
+//  false aussi si la transaction a échoué (attente abandonnée)
 //------------------------------------------------------------------------------
 //
 // Modification de  BOOL TransmitOneByte( UINT8 data )
@@ -174,18 +214,21 @@ void i2c_reStart(void)
 bool i2c_write( uint8_t data )
 {
     bool  AckBit;
-  
-    // Wait for the bus to be idle (ncessaire aprs un reStart)
-    while(PLIB_I2C_BusIsIdle(KIT_I2C_BUS) == false);
+
+    if (i2cFailed)
+        return false;
+
+    // Wait for the bus to be idle (nécessaire aprés un reStart)
+    I2C_WAIT(PLIB_I2C_BusIsIdle(KIT_I2C_BUS), false);
 
     // Wait for the transmitter to be ready
-    while( PLIB_I2C_TransmitterIsReady(KIT_I2C_BUS) == false);
+    I2C_WAIT(PLIB_I2C_TransmitterIsReady(KIT_I2C_BUS), false);
    
     // Transmit the byte
     PLIB_I2C_TransmitterByteSend(KIT_I2C_BUS, data);
     
-    while(PLIB_I2C_TransmitterIsBusy(KIT_I2C_BUS));              //Wait as long as TBF = 1
-    while(!PLIB_I2C_TransmitterByteHasCompleted(KIT_I2C_BUS));   //Wait as long as TRSTAT == 1
+    I2C_WAIT(!PLIB_I2C_TransmitterIsBusy(KIT_I2C_BUS), false);          //Wait as long as TBF = 1
+    I2C_WAIT(PLIB_I2C_TransmitterByteHasCompleted(KIT_I2C_BUS), false); //Wait as long as TRSTAT == 1
   
     AckBit = PLIB_I2C_TransmitterByteWasAcknowledged(KIT_I2C_BUS);
    
@@ -197,23 +240,28 @@ bool i2c_write( uint8_t data )
 // i2c_stop()
 //
 // termine la transaction I2C master
-//
+// Valeur de retour : false si la transaction a échoué, stop non émis ;
+//  le bus est alors à libérer (i2c_recoverStart)
 //------------------------------------------------------------------------------
 //
 // Modification de  void StopTransfer( void )
 // - pas de modif sauf le nom de la fonction
 // Adaptation plib_i2c  : 19.03.2015 CHR
 
-void i2c_stop( void )
+bool i2c_stop( void )
 {
+    if (i2cFailed)
+        return false;
+
     // Attente bus au repos
-    while(PLIB_I2C_BusIsIdle(KIT_I2C_BUS) == false);
+    I2C_WAIT(PLIB_I2C_BusIsIdle(KIT_I2C_BUS), false);
 
     PLIB_I2C_MasterStop(KIT_I2C_BUS);
 
     // Wait for the signal to complete
-    while (PLIB_I2C_StopWasDetected(KIT_I2C_BUS) == false);
-   
+    I2C_WAIT(PLIB_I2C_StopWasDetected(KIT_I2C_BUS), false);
+
+    return true;
 } // end i2c_stop
 
 
@@ -222,14 +270,18 @@ void i2c_stop( void )
 //
 // Syntaxe : 	data = i2c_read (ack);
 // La fonction retourne l'octet lu.
-// Paramtre ackTodo :
+// Paramètre ackTodo :
 //  1 (true)  signifie qu'il faut effectuer l'acquittement.
 //  0 (false) signifie qu'il ne faut pas effectuer l'acquittement.
+// Rend 0xFF si la transaction a échoué (voir i2c_timedOut)
 // Adaptation plib_i2c  : 19.03.2015 CHR
 uint8_t i2c_read(bool ackTodo)
 {
     uint8_t i2cByte;
 
+    if (i2cFailed)
+        return 0xFF;
+
     // BSP_LEDOn(BSP_LED_5);  // provisoire : pour observation
    
     // ajout idem driver statique I2C de Harmony 1_03
@@ -246,11 +298,11 @@ uint8_t i2c_read(bool ackTodo)
     PLIB_I2C_MasterReceiverClock1Byte(KIT_I2C_BUS);
 
     // Wait till RBF = 1; Which means data is available in I2C2RCV reg
-    while(!PLIB_I2C_ReceivedByteIsAvailable(KIT_I2C_BUS));
+    I2C_WAIT(PLIB_I2C_ReceivedByteIsAvailable(KIT_I2C_BUS), 0xFF);
     
     i2cByte = PLIB_I2C_ReceivedByteGet(KIT_I2C_BUS); //Read from I2CxRCV
 
-    while ( PLIB_I2C_MasterReceiverReadyToAcknowledge ( KIT_I2C_BUS ) == false );
+    I2C_WAIT(PLIB_I2C_MasterReceiverReadyToAcknowledge(KIT_I2C_BUS), 0xFF);
 
      if (ackTodo) {
           PLIB_I2C_ReceivedByteAcknowledge ( KIT_I2C_BUS, true );
@@ -259,10 +311,90 @@ uint8_t i2c_read(bool ackTodo)
      }
 
     // wait till ACK/NACK sequence is complete i.e ACKEN = 0
-    while( PLIB_I2C_MasterReceiverReadyToAcknowledge (KIT_I2C_BUS) == false);
+    I2C_WAIT(PLIB_I2C_MasterReceiverReadyToAcknowledge(KIT_I2C_BUS), 0xFF);
    
     // BSP_LEDOff(BSP_LED_5); // provisoire : pour observation
 
     return i2cByte;
 } // end i2c_read
 
+
+bool i2c_timedOut(void)
+{
+    return i2cFailed;
+}
+
+uint32_t i2c_timeoutCount(void)
+{
+    return i2cSpinTimeouts;
+}
+
+
+// Récupération : 9 impulsions SCL (2 appels de i2c_recoverStep chacune),
+// puis stop manuel en 3 appels
+#define RECOVER_PULSES  18
+
+static bool     recovering;
+static uint8_t  recoverStep;
+static uint32_t recoveries;
+
+
+//------------------------------------------------------------------------------
+// i2c_recoverStart / i2c_recoverStep
+//
+// Libération d'un bus retenu par un esclave (voir Mc32_I2cUtilCCS.h).
+// Un pas par appel de i2c_recoverStep : impulsions SCL tant que SDA est
+// retenue, puis stop (SDA monte, SCL haute) et module réactivé.
+//------------------------------------------------------------------------------
+
+void i2c_recoverStart(void)
+{
+    PLIB_I2C_Disable(KIT_I2C_BUS);
+    PLIB_PORTS_PinSet(PORTS_ID_0, KIT_I2C_PORT, KIT_I2C_SCL);
+    PLIB_PORTS_PinDirectionOutputSet(PORTS_ID_0, KIT_I2C_PORT, KIT_I2C_SCL);
+    PLIB_PORTS_PinDirectionInputSet(PORTS_ID_0, KIT_I2C_PORT, KIT_I2C_SDA);
+    recovering = true;
+    recoverStep = 0;
+    recoveries++;
+}
+
+bool i2c_recoverStep(void)
+{
+    if (!recovering)
+        return true;
+    if (recoverStep < RECOVER_PULSES)
+    {
+        if ((recoverStep & 1) == 0)
+            PLIB_PORTS_PinClear(PORTS_ID_0, KIT_I2C_PORT, KIT_I2C_SCL);
+        else
+        {
+            PLIB_PORTS_PinSet(PORTS_ID_0, KIT_I2C_PORT, KIT_I2C_SCL);
+            if (PLIB_PORTS_PinGet(PORTS_ID_0, KIT_I2C_PORT, KIT_I2C_SDA))
+                recoverStep = RECOVER_PULSES - 1;   // SDA libérée
+        }
+    }
+    else if (recoverStep == RECOVER_PULSES)
+    {
+        PLIB_PORTS_PinClear(PORTS_ID_0, KIT_I2C_PORT, KIT_I2C_SCL);
+        PLIB_PORTS_PinClear(PORTS_ID_0, KIT_I2C_PORT, KIT_I2C_SDA);
+        PLIB_PORTS_PinDirectionOutputSet(PORTS_ID_0, KIT_I2C_PORT, KIT_I2C_SDA);
+    }
+    else if (recoverStep == RECOVER_PULSES + 1)
+        PLIB_PORTS_PinSet(PORTS_ID_0, KIT_I2C_PORT, KIT_I2C_SCL);
+    else
+    {
+        // SDA relâchée avec SCL haute : stop ; broches rendues au module
+        PLIB_PORTS_PinDirectionInputSet(PORTS_ID_0, KIT_I2C_PORT, KIT_I2C_SDA);
+        PLIB_PORTS_PinDirectionInputSet(PORTS_ID_0, KIT_I2C_PORT, KIT_I2C_SCL);
+        PLIB_I2C_Enable(KIT_I2C_BUS);
+        recovering = false;
+        return true;
+    }
+    recoverStep++;
+    return false;
+}
+
+uint32_t i2c_recoveryCount(void)
+{
+    return recoveries;
+}
@@ -9,10 +9,14 @@
 //	Compilateur	:	XC32 V1.33 & Harmony V1.00
 //  Modifications :
 //  	CHR 19.03.2015  Migration sur plib_i2c de Harmony 1.00   CHR
-//      CHR 12.04.2016  adaptaion dtails pour plib_i2c de Harmony 1.06   CHR
-//		SCA 04.04.2017  Complments commentaires i2c_init HighFrequencyEnable/Disable
+//      CHR 12.04.2016  adaptaion détails pour plib_i2c de Harmony 1.06   CHR
+//		SCA 04.04.2017  Compléments commentaires i2c_init HighFrequencyEnable/Disable
 //  	SCA 18.03.2024  v1.51 MPLABX 5.50/xc32 2.50/Harmony 2.06
 //                   Correction commentaire acknowledge i2c_write()
+//      17.10.2026  v1.60 Attentes bornées (I2C_SPIN_MAX), abandon rendu
+//                   à l'appelant, correction des tests de collision ;
+//                   récupération du bus
+//                   (i2c_recoverStart, i2c_recoverStep)
 //--------------------------------------------------------
 
 #ifndef MC32_I2CUTILCCS_H
@@ -31,10 +35,43 @@
 //------------------------------------------------------------------------------
 
 void i2c_init( bool Fast );
-void i2c_start(void);
-void i2c_reStart(void);
+
+
+//------------------------------------------------------------------------------
+// Fonctions bloquantes, chaque attente bornée à ~2 ms (I2C_SPIN_MAX).
+// Une attente abandonnée termine la fonction en échec (false, 0xFF pour
+// i2c_read) ; les appels suivants échouent aussitôt jusqu'au prochain
+// i2c_start, stop compris : le bus reste à libérer (i2c_recoverStart).
+//------------------------------------------------------------------------------
+
+bool i2c_start(void);
+bool i2c_reStart(void);
 bool i2c_write( uint8_t data );
 uint8_t i2c_read(bool ackTodo);
-void i2c_stop( void );
+bool i2c_stop( void );
+
+bool i2c_timedOut(void);            // Vrai : attente abandonnée depuis i2c_start
+uint32_t i2c_timeoutCount(void);    // Attentes abandonnées, total
+
+
+//------------------------------------------------------------------------------
+// Récupération du bus
+//
+// Un esclave interrompu au milieu d'un octet (transaction abandonnée,
+// reset du maître) peut retenir SDA basse indéfiniment : le module ne
+// voit alors plus jamais le bus libre. i2c_recoverStart coupe le module
+// et pilote SCL en sortie ; chaque appel de i2c_recoverStep avance d'une
+// demi-période : jusqu'à 9 impulsions SCL tant que SDA reste basse, puis
+// une condition stop produite à la main. Au dernier pas (vrai), les
+// broches sont rendues au module, réactivé. Non bloquant : cadencé par
+// l'appelant (tick de supervision), 21 appels au plus.
+//
+// Utilisée par i2cbus.c après le timeout d'une transaction du driver
+// DRV_I2C0 (même module I2C1), qui est arrêté pendant la récupération.
+//------------------------------------------------------------------------------
+
+void i2c_recoverStart(void);
+bool i2c_recoverStep(void);         // Vrai : terminé, module réactivé
+uint32_t i2c_recoveryCount(void);
 
 #endif
@@ -5,13 +5,25 @@
 #include "app.h"
 #include "system_config.h"
 #include "system_definitions.h"
+#include "regul.h"
+#include "comp.h"
+#include "pwm.h"
+#include "ilim.h"
+#include "fault.h"
+#include "ina226.h"
+#include "i2cbus.h"
+#include "lm92.h"
+#include "derate.h"
+#include "telem.h"
+#include "scope.h"
+#include "profile.h"
 #include <math.h>
 
 // *****************************************************************************
 // Section: Global Data Definitions
 // *****************************************************************************
 
-APP_DATA appData; // Structure globale d?tat de l'application
+APP_DATA appData; // Structure globale d?état de l'application
 
 // *****************************************************************************
 // Section: Application Initialization and State Machine
@@ -22,19 +34,22 @@ void APP_Initialize(void) {
 }
 
 void APP_Tasks(void) {
+    PROFILE_BEGIN(PROFILE_APP_TASKS);
     switch (appData.state) {
         case APP_STATE_INIT:
         {
-            // Extinction des LEDs au dmarrage
+            // Extinction des LEDs au démarrage
             RED_LEDOff();
             YELLOW_LEDOff();
             GREEN_LEDOff();
             BLUE_LEDOff();
             
-            // Dmarrage des modules PWM et timers
-            DRV_OC0_Start(); // PWM OC0
-            DRV_TMR1_Start(); // Timer1 (rgulation)
-            DRV_TMR0_Start(); // Timer0 (autres tches)
+            ShutDownOff(); // Driver libéré (PWM à 0 jusqu'à la régulation)
+            APP_MonitorStart(); // INA226 : configuration écrite par l'ISR I2C
+
+            // Démarrage PWM + ADC synchrone (la régulation suit l'ADC)
+            APP_RegulationStart();
+            DRV_TMR0_Start(); // Timer0 : supervision
 
             appData.state = APP_STATE_WAIT;
             break;
@@ -42,14 +57,15 @@ void APP_Tasks(void) {
 
         case APP_STATE_WAIT:
         {
-            // Pas d'action spcifique ici
+            TELEM_IlimSet(appData.ilim.thresholdmA, appData.ilim.count);
+            TELEM_Tasks(); // Télémétrie : mise en trame, relance du DMA
             break;
         }
 
         case APP_STATE_SERVICE_TASKS:
         {
 
-            //  utiliser pour d'autres traitements si besoin
+            // À utiliser pour d'autres traitements si besoin
             break;
         }
 
@@ -58,157 +74,810 @@ void APP_Tasks(void) {
             break;
         }
     }
+    PROFILE_END(PROFILE_APP_TASKS);
 }
 
-// Changement manuel d?tat de la machine d'tat
+// Changement manuel d?état de la machine d'état
 
 void APP_UpdateState(APP_STATES Newstate) {
     appData.state = Newstate;
 }
 
 // *****************************************************************************
-// Section: Rgulation numrique avec protection
+// Section: Régulation numérique avec protection
 // *****************************************************************************
 
-// === PARAMTRES DU SYSTME ===
-#define VREF            3.3f       // Rfrence ADC
-#define ADC_MAX         1023.0f    // Rsolution 10 bits
+// === PARAMÈTRES DU SYSTÈME ===
+#define VREF            3.3f       // Référence ADC
+#define ADC_MAX         1023.0f    // Résolution 10 bits
 #define TARGET_V        5.0f       // Tension cible de sortie (en V)
 
 // === CONSTANTES PID ===
+// La période d'échantillonnage DT n'est pas une constante : elle vaut
+// CTRL_DECIM périodes PWM effectives et est calculée au démarrage.
 #define KP              1.0f       // Gain proportionnel
-#define KI              40.0f      // Gain intgral
-#define DT              0.0001f    // Priode d'chantillonnage (100 s)
+#define KI              40.0f      // Gain intégral
+
+// === CASCADE (APP_REGUL_CASCADE) ===
+// Boucle externe : erreur de tension -> consigne de courant (A), bornée
+// à ILIM : la limitation de courant est intrinsèque.
+// Boucle interne : erreur de courant -> rapport cyclique.
+#define KP_V            1.0f       // A/V
+#define KI_V            100.0f     // A/(V.s)
+#define ILIM            3.5f       // Consigne de courant max (A), < IPEAK_LIM
+#define KP_I            0.02f      // 1/A
+#define KI_I            50.0f      // 1/(A.s)
+
+// === LIMITATION CYCLE PAR CYCLE ===
+// Seuil crête sur le courant de sortie (comparateur 1 et CVREF, voir
+// ilim.h), arrondi au niveau de CVREF inférieur : 3.60 A effectifs.
+// Modifiable en fonctionnement par APP_CurrentLimitSet() ; doit rester
+// sous MAX_IOUT pour qu'une surcharge brève ne provoque pas de coupure.
+#define IPEAK_LIM       3.7f       // A
+
+// === GESTION DES DÉFAUTS (fault.h) ===
+// Après une coupure, l'étage reste éteint le temps d'extinction de la
+// cause puis redémarre en rampe si Vout < 95 % de la consigne. Chaque
+// cause dispose d'un budget de reprises, rendu après FAULT_GOOD_MS de
+// marche sans défaut ; budget épuisé : verrouillage (FAULT_Reset).
+// I²t : surcharge tolérée au-dessus de I2T_INOM jusqu'à I2T_LIMIT
+// (0.7 A².s : 4 A pendant 100 ms, la limite crête 3.6 A pendant 180 ms).
+#define FAULT_MS(ms)    ((uint16_t)((ms) * SUPERV_FREQ / 1000ul))
+#define FAULT_GOOD_MS   1000ul     // Marche saine rendant le budget
+#define I2T_INOM        3.0f       // Courant permanent admissible (A)
+#define I2T_LIMIT       0.7f       // A².s
+
+// === MONITEUR INA226 (ina226.h) ===
+// Lecture bus + shunt lancée par ALERT (RB7, change notification) à la
+// fin de chaque mesure complète (8.8 ms, INA226_CONFIG_RUN) : le bus
+// I2C ne sert que lorsqu'une nouvelle mesure existe. La supervision
+// publie le résultat et relance la lecture si ALERT reste muette (front
+// perdu, ALERT déjà basse avant la validation de la change notification).
+#define INA_PERIOD_MS   10ul       // Période de publication
+#define INA_STALE_MS    50ul       // Sans nouvelle mesure : relance
+#define INA_RSHUNT      0.01f      // Shunt de l'INA226 (ohm) : 8.2 A max
+#define INA_ALERT_A     MAX_IOUT   // Fonction d'alerte : surintensité
+
+// === RÉDUCTION THERMIQUE (lm92.h, derate.h) ===
+// Température de carte lue par le LM92 (client de priorité basse du bus
+// I2C1). Au-delà de TEMP_DERATE_START, le courant de coupure de
+// CheckSafety décroît linéairement de MAX_IOUT à DERATE_KMIN.MAX_IOUT à
+// TEMP_DERATE_END. Pendant la réduction, la consigne de tension est
+// repliée pour tenir le courant moyen sous DERATE_FOLD fois ce courant
+// (la charge reste alimentée au lieu de déclencher), puis remonte à
+// DERATE_SLEW quand la charge ou la température le permet. Sans mesure
+// depuis TEMP_STALE_MS : réduction maximale. Le facteur ne descend pas
+// plus vite que DERATE_FALL_MS pour la plage complète : le repli (moyenne
+// sur 16 ms) ramène le courant avant que le seuil de coupure ne l'atteigne.
+#define TEMP_PERIOD_MS  500ul      // Période de lecture du LM92
+#define TEMP_STALE_MS   2000ul     // Sans nouvelle mesure : DERATE_KMIN
+#define TEMP_DERATE_START 85.0f    // Début de la réduction (°C)
+#define TEMP_DERATE_END 110.0f     // Réduction maximale (°C)
+#define DERATE_KMIN     0.25f      // Fraction de MAX_IOUT à TEMP_DERATE_END
+#define DERATE_FOLD     0.875f     // Repli : fraction du courant de coupure
+#define DERATE_SLEW     10.0f      // Remontée de la consigne (V/s)
+#define DERATE_FALL_MS  1000ul     // Descente de 1.0 à DERATE_KMIN (ms)
+
+// === CAPTURE DÉCLENCHÉE (scope.h) ===
+// Armée au démarrage : figée sur la première coupure (CheckSafety, OCP
+// matériel) avec les 3/4 de la fenêtre avant le défaut. Relecture par le
+// débogueur ou SCOPE_Read(), réarmement par SCOPE_Arm().
+#define CAPTURE_SOURCE  SCOPE_SRC_VOUT
+#define CAPTURE_TRIGGER SCOPE_TRIG_FAULT
+#define CAPTURE_LEVEL   0          // Seuil ou pente (unité de la source)
+#define CAPTURE_PRE     (SCOPE_DEPTH * 3 / 4)
+#define CAPTURE_DECIM   1          // Un échantillon par pas de régulation
+
+// === SOFT-START ===
+// Au démarrage et après chaque reprise, la consigne part de la tension
+// déjà présente en sortie (pré-charge) et monte vers TARGET_V à SS_SLEW ;
+// les termes intégraux sont préchargés avec le rapport cyclique qui
+// maintient cette tension (buck : Vout / Vin) : pas d'à-coup ni de
+// décharge de la sortie.
+#define SS_SLEW         1000.0f    // V/s (5 V en 5 ms)
+#define VIN_NOM         12.0f      // Tension d'entrée nominale (V)
+
+// === ANTI-EMBALLEMENT ===
+// Stratégie des PI quand la sortie est bornée (voir PI_AW_MODE). En
+// poursuite, la constante Tt vaut le Ti (KP / KI) de chaque boucle.
+#ifndef APP_PI_AW
+#define APP_PI_AW       PI_AW_CLAMP
+#endif
+
+// === COMPENSATEUR (APP_REGUL_COMP) ===
+// Coefficients discrets générés par tp4_design (comp_coef.h) pour une
+// cadence de régulation donnée : à régénérer si PWM_FREQ ou CTRL_DECIM
+// change (make -C firmware/host coef).
+
+#if APP_REGUL_COMP && APP_REGUL_CASCADE
+#error "APP_REGUL_COMP : boucle de tension seule"
+#endif
 
 // === GAINS HARDWARE ===
 #define SHUNT_GAIN      21.0f      // Gain ampli courant
+#define SHUNT_R         0.03f      // Shunt de sortie (ohm) : 3.3 V <-> 5.2 A
 #define VOUT_GAIN       3.06f      // Ratio diviseur tension
 
-// === LIMITES SCURIT (hardcodes) ===
+// === LIMITES SÉCURITÉ (hardcodées) ===
+// Contrôlées par la supervision, une fois par tick. La coupure rapide
+// est matérielle : entrée OCFA de OC1 (voir pwm.h) et ShutDown (RB0,
+// driver bloqué à l'état haut).
 #define MAX_VOUT        5.5f       // Tension max (V)
 #define MAX_IOUT        4.8f       // Courant max (A)
 
-static float integrale = 0.0f; // Terme intgral du rgulateur
-static bool faultState = false; // Drapeau d'erreur
-
-// Rglage du PWM entre 0.0 et 1.0 (rapport cyclique)
+// === DÉCOUPAGE ===
+// Période et prescaler de Timer2 calculés par PWM_Configure()
+#define PWM_FREQ        10000ul    // Fréquence de découpage (Hz)
+
+// === CADENCES ===
+// Régulation : une fois toutes les CTRL_DECIM périodes PWM (décimation
+// faite par l'ADC, 1..PWM_DECIM_MAX). Supervision (protection, reprise,
+// télémétrie) : Timer1 à SUPERV_FREQ, priorité 1, interrompue par la
+// régulation (ADC, priorité 2).
+#ifndef CTRL_DECIM
+#define CTRL_DECIM      1
+#endif
+#define SUPERV_FREQ     1000ul     // Hz
+
+#if CTRL_DECIM < 1 || CTRL_DECIM > PWM_DECIM_MAX
+#error "CTRL_DECIM hors plage"
+#endif
+
+// === ACQUISITION ADC ===
+// MUX A (AN12) puis MUX B (AN11), conversions déclenchées par Timer3,
+// 2.CTRL_DECIM par séquence rangées alternativement dans ADC1BUF0..7 et
+// ADC1BUF8..F. Index de la paire la plus récente dans la moitié lue :
+#define ADC_HALF_SIZE   8
+#define ADC_IDX_IOUT    (2 * CTRL_DECIM - 2) // AN12, MUX A (point - T/2)
+#define ADC_IDX_VOUT    (2 * CTRL_DECIM - 1) // AN11, MUX B (point)
+
+// Instant d'échantillonnage de Vout dans la période PWM (fraction de T)
+// 0.25 : milieu de conduction autour de 50 % de rapport cyclique
+#define ADC_TRIG_POINT  Q15(0.25)
+
+// === DOMAINE ENTIER (codes ADC) ===
+// Constantes évaluées à la compilation : aucun calcul flottant à l'exécution
+#define LSB_VOUT        (VREF / ADC_MAX * VOUT_GAIN)    // V par code
+#define LSB_IOUT        (VREF / ADC_MAX / SHUNT_GAIN / SHUNT_R) // A par code
+#define IOUT_FULL       ((ADC_MAX + 1.0f) * LSB_IOUT)   // Pleine échelle (A)
+#define VOUT_TO_CODE(v) ((int32_t)((v) / LSB_VOUT))     // Troncature : exacte pour '>'
+#define IOUT_TO_CODE(i) ((int32_t)((i) / LSB_IOUT))
+
+#define TARGET_V_CODE   ((int32_t)(TARGET_V / LSB_VOUT + 0.5f))
+#define MAX_VOUT_CODE   VOUT_TO_CODE(MAX_VOUT)
+#define MAX_IOUT_CODE   IOUT_TO_CODE(MAX_IOUT)
+#define INA_ALERT_CODE  ((uint16_t)(INA_ALERT_A * INA_RSHUNT / INA226_SHUNT_LSB))
+#define SAFE_VOUT_CODE  VOUT_TO_CODE(TARGET_V * 0.95f)
+#define PRELOAD_DUTY    Q31(LSB_VOUT / VIN_NOM)         // Rapport cyclique par code
+#define TEMP_TO_16(t)   ((int16_t)((t) * 16.0f))              // LM92 : 1/16 °C
+#define DERATE_STEP_Q16 ((int32_t)(DERATE_SLEW / SUPERV_FREQ / LSB_VOUT * 65536.0f))
+#define DERATE_K_STEP   ((uint16_t)((DERATE_ONE - Q15(DERATE_KMIN)) / (DERATE_FALL_MS * SUPERV_FREQ / 1000ul)))
+#define I2T_NOM_CODE2   ((int32_t)(I2T_INOM / LSB_IOUT * (I2T_INOM / LSB_IOUT)))
+#define I2T_LIMIT_CODE2 ((int32_t)(I2T_LIMIT / (LSB_IOUT * LSB_IOUT) * SUPERV_FREQ))
+
+// Politique par cause (ordre de FAULT_CAUSE) : extinction, reprises
+static const FAULT_POLICY faultPolicy[FAULT_CAUSE_NB] =
+{
+    { FAULT_MS(100), 3 },   // Surtension
+    { FAULT_MS(50),  5 },   // Surintensité instantanée
+    { FAULT_MS(100), 5 },   // Défaut matériel OCFA
+    { FAULT_MS(500), 3 },   // I²t : extinction longue
+};
+
+// Drapeau d'erreur : écrit par la supervision, lu par la régulation
+static volatile bool faultState = false;
+
+// Moyennes et plafond du repli thermique (supervision)
+static DERATE_STATE derateState;
+
+// En cascade, piParam/piState sont la boucle de tension (sortie :
+// consigne de courant) et piCurParam/piCurState la boucle de courant.
+#if APP_REGUL_FIXED
+static PI_FIX_PARAM piParam;    // Gains, DT calculé par APP_RegulationStart
+#if !APP_REGUL_COMP
+static PI_FIX_STATE piState;    // Terme intégral du régulateur (Q31)
+#endif
+#if APP_REGUL_CASCADE
+static PI_FIX_PARAM piCurParam; // Sortie : rapport cyclique
+static PI_FIX_STATE piCurState;
+#endif
+#else
+#if APP_REGUL_CASCADE
+static PI_FLOAT_PARAM piParam = { KP_V, KI_V, 0.0f, 0.0f, ILIM };
+static PI_FLOAT_PARAM piCurParam = { KP_I, KI_I, 0.0f, 0.0f, 1.0f };
+static PI_FLOAT_STATE piCurState;
+#else
+static PI_FLOAT_PARAM piParam = { KP, KI, 0.0f, 0.0f, 1.0f };
+#endif
+#if !APP_REGUL_COMP
+static PI_FLOAT_STATE piState;  // Terme intégral du régulateur
+#endif
+#endif
+
+#if APP_REGUL_COMP
+#include "comp_coef.h"
+#if COMP_COEF_FS_HZ != PWM_FREQ / CTRL_DECIM
+#error "comp_coef.h calculé pour une autre cadence de régulation"
+#endif
+#if APP_REGUL_FIXED
+static const COMP_FIX_PARAM compParam = COMP_COEF_FIX;
+static COMP_FIX_STATE compState;
+#else
+static const COMP_FLOAT_PARAM compRef = COMP_COEF_FLOAT;
+static COMP_FLOAT_STATE compState;
+#endif
+#endif
+
+// Etat de la loi de commande transmis par la télémétrie : terme intégral
+// de la boucle de tension, ou dernière sortie du compensateur
+#if APP_REGUL_COMP && APP_REGUL_FIXED
+#define REGUL_INTEG_BITS()  ((uint32_t)compState.y[0])
+#define REGUL_INTEG_Q15()   ((int16_t)(compState.y[0] >> 16))
+#define REGUL_INTEG_FORMAT  (TELEM_INTEG_Q31 | TELEM_INTEG_OUTPUT)
+#elif APP_REGUL_COMP
+#define REGUL_INTEG_BITS()  TELEM_FloatBits(compState.y[0])
+#define REGUL_INTEG_Q15()   SCOPE_FloatQ15(compState.y[0])
+#define REGUL_INTEG_FORMAT  (TELEM_INTEG_FLOAT | TELEM_INTEG_OUTPUT)
+#elif APP_REGUL_FIXED
+#define REGUL_INTEG_BITS()  ((uint32_t)piState.integ)
+#define REGUL_INTEG_Q15()   ((int16_t)(piState.integ >> 16))
+#define REGUL_INTEG_FORMAT  TELEM_INTEG_Q31
+#else
+#define REGUL_INTEG_BITS()  TELEM_FloatBits(piState.integrale)
+#define REGUL_INTEG_Q15()   SCOPE_FloatQ15(piState.integrale)
+#define REGUL_INTEG_FORMAT  TELEM_INTEG_FLOAT
+#endif
+
+// Réglage du PWM entre 0.0 et 1.0 (rapport cyclique)
 
 void SetPWM(float duty) {
     // Saturation logique entre 0 et 1
     if (duty < 0.0f) duty = 0.0f;
     if (duty > 1.0f) duty = 1.0f;
 
-    const uint32_t period = 59999; // Timer2 rgl dans Harmony
-    uint32_t compare = (uint32_t) (duty * period); // Valeur de compare
+    uint32_t compare = (uint32_t) (duty * PWM_PeriodTicks()); // Valeur de compare
 
 
-    DRV_OC0_PulseWidthSet(compare); // Application PWM
+    PWM_DutySetTicks(compare); // Application PWM
 }
 
-// Lecture tension de sortie (via ADC sur AN11)
+// Réglage du PWM en Q31 (0 = 0 %, Q31_MAX = 100 %), sans flottant
 
-float ReadVout(void) {
-    uint16_t adcVal = DRV_ADC_SamplesRead(1); // AN11
+void SetPWMFix(q31_t duty) {
+    PWM_DutySetFix(duty); // Mise à l'échelle sur la période configurée
+}
+
+// Moitié du buffer ADC contenant la dernière séquence complète
+// (l'autre est en cours de remplissage). La conversion suivante n'a lieu
+// qu'une demi-période plus tard : aucun risque d'écrasement pendant la
+// lecture.
+
+static uint8_t AdcReadyBase(void) {
+    return (PLIB_ADC_ResultBufferStatusGet(DRV_ADC_ID_1) == ADC_FILLING_BUF_0TO7)
+            ? ADC_HALF_SIZE : 0;
+}
+
+// Lecture brute tension de sortie (code ADC AN11)
+
+uint16_t ReadVoutCode(void) {
+    return DRV_ADC_SamplesRead(AdcReadyBase() + ADC_IDX_VOUT);
+}
+
+// Lecture brute courant de sortie (code ADC AN12)
+
+uint16_t ReadIoutCode(void) {
+    return DRV_ADC_SamplesRead(AdcReadyBase() + ADC_IDX_IOUT);
+}
+
+// Conversion code AN11 -> tension de sortie (V)
+
+static float _VoutFromCode(uint16_t adcVal) {
     float vin = (adcVal * VREF / ADC_MAX); // Conversion ADC -> tension
     return vin * VOUT_GAIN; // Application du gain (diviseur)
 }
 
+// Conversion code AN12 -> courant de sortie (A)
+
+static float _IoutFromCode(uint16_t adcVal) {
+    float vamp = (adcVal * VREF / ADC_MAX); // Tension ampli de shunt
+    return vamp / SHUNT_GAIN / SHUNT_R; // Tension shunt -> courant
+}
+
+// Lecture tension de sortie (via ADC sur AN11)
+
+float ReadVout(void) {
+    return _VoutFromCode(ReadVoutCode());
+}
+
 // Lecture courant de sortie (via ADC sur AN12)
 
 float ReadIout(void) {
-    uint16_t adcVal = DRV_ADC_SamplesRead(0); // AN12
-    float vshunt = (adcVal * VREF / ADC_MAX); // Tension sur shunt
-    return vshunt / SHUNT_GAIN; // Application gain shunt
+    return _IoutFromCode(ReadIoutCode());
+}
+
+// Acquisition unique de la période : chaque entrée est lue une seule fois
+
+void APP_Acquire(APP_MEASURE *meas) {
+    uint8_t base = AdcReadyBase(); // Même séquence pour les deux entrées
+
+    meas->vOutCode = DRV_ADC_SamplesRead(base + ADC_IDX_VOUT);
+    meas->iOutCode = DRV_ADC_SamplesRead(base + ADC_IDX_IOUT);
+#if !APP_REGUL_FIXED
+    meas->vOut = _VoutFromCode(meas->vOutCode);
+    meas->iOut = _IoutFromCode(meas->iOutCode);
+#endif
+}
+
+// Copie de la dernière acquisition hors de l'ISR de régulation (la
+// supervision peut être interrompue au milieu de la lecture)
+
+void APP_MeasureGet(APP_MEASURE *meas) {
+    bool enabled = SYS_INT_SourceDisable(INT_SOURCE_ADC_1);
+
+    *meas = appData.meas;
+    SYS_INT_SourceRestore(INT_SOURCE_ADC_1, enabled);
+}
+
+// Préchargement des régulateurs sur le point de fonctionnement mesuré :
+// rapport cyclique de maintien de Vout et, en cascade, consigne de
+// courant égale au courant débité
+
+static void RegulPreload(const APP_MEASURE *meas) {
+#if APP_REGUL_FIXED
+    q31_t duty = Q31_Limit(Q31_MulInt(PRELOAD_DUTY, meas->vOutCode), 0, Q31_MAX);
+#if APP_REGUL_CASCADE
+    PI_PreloadFix(&piState, (q31_t)meas->iOutCode << 21); // code / 1024 en Q31
+    PI_PreloadFix(&piCurState, duty);
+#elif APP_REGUL_COMP
+    COMP_PreloadFix(&compState, duty);
+#else
+    PI_PreloadFix(&piState, duty);
+#endif
+#else
+    float duty = meas->vOut / VIN_NOM;
+    if (duty > 1.0f) duty = 1.0f;
+#if APP_REGUL_CASCADE
+    PI_PreloadFloat(&piParam, &piState, meas->iOut);
+    PI_PreloadFloat(&piCurParam, &piCurState, duty);
+#elif APP_REGUL_COMP
+    COMP_PreloadFloat(&compState, duty);
+#else
+    PI_PreloadFloat(&piParam, &piState, duty);
+#endif
+#endif
+}
+
+// Démarrage progressif : armé hors ISR, la capture de la pré-charge se
+// fait au pas de régulation suivant (mesure fraîche)
+
+static void SoftStartArm(void) {
+    appData.ss.armed = true;
+}
+
+// Premier pas après armement : consigne = tension mesurée, régulateurs
+// préchargés. Au-dessus de la cible, la consigne est directement TARGET_V.
+
+static void SoftStartBegin(const APP_MEASURE *meas) {
+    APP_SOFTSTART *ss = &appData.ss;
+
+    ss->refQ16 = (int32_t)meas->vOutCode << 16;
+    ss->active = (ss->refQ16 < ss->targetQ16);
+    if (!ss->active)
+        ss->refQ16 = ss->targetQ16;
+    RegulPreload(meas);
+    ss->armed = false;
+}
+
+// Consigne du pas courant (codes AN11)
+
+static int32_t SoftStartStep(void) {
+    APP_SOFTSTART *ss = &appData.ss;
+    int32_t target = ss->targetQ16;
+
+    if (ss->limitQ16 < target) target = ss->limitQ16; // Repli thermique
+
+    if (ss->refQ16 > target) {
+        ss->refQ16 = target; // Repli immédiat
+    } else if (ss->active || ss->refQ16 < target) {
+        ss->refQ16 += ss->stepQ16;
+        if (ss->refQ16 >= target) {
+            ss->refQ16 = target; // Fin de rampe : régulation nominale
+            ss->active = false;
+        }
+    }
+    return (ss->refQ16 + 0x8000) >> 16;
+}
+
+// Traces du pas (ISR de régulation) : échantillon de télémétrie et
+// capture déclenchée
+
+static inline void TraceStep(const APP_MEASURE *meas) {
+    SCOPE_SAMPLE s;
+    uint16_t vOut = meas->vOutCode;
+
+    s.vOut = meas->vOutCode;
+    s.iOut = meas->iOutCode;
+    s.error = (int16_t)((appData.ss.refQ16 >> 16) - (int32_t)meas->vOutCode);
+    s.integ = REGUL_INTEG_Q15();
+    s.duty = PWM_DutyGet();
+    SCOPE_Sample(&s, faultState);
+
+    if (faultState) vOut |= TELEM_FLAG_FAULT;
+    if (ILIM_IsActive()) vOut |= TELEM_FLAG_ILIM;
+    if (appData.ss.active) vOut |= TELEM_FLAG_RAMP;
+    TELEM_Push(vOut, s.iOut, s.duty, REGUL_INTEG_BITS());
 }
 
-// Vrification des seuils scurit (tension + courant)
+// Télémétrie : échelles et format en tête du flux (période PWM effective)
+
+static void TelemetryStart(void) {
+    TELEM_INFO info;
+
+    info.sampleHz = (uint16_t)(PWM_FrequencyGet() / CTRL_DECIM);
+    info.lsbVout = LSB_VOUT;
+    info.lsbIout = LSB_IOUT;
+    info.dutyFull = (uint16_t)PWM_PeriodTicks();
+    info.integFormat = REGUL_INTEG_FORMAT;
+    info.ilimmA = appData.ilim.thresholdmA;
+    info.ilimCount = appData.ilim.count;
+    TELEM_Initialize(&info);
+}
+
+// Inscription d'une coupure dans le journal
+
+static void FaultLog(uint8_t cause, const APP_MEASURE *meas) {
+    appData.fault.cause = cause;
+    appData.fault.tick = appData.tick;
+    appData.fault.meas = *meas;
+}
+
+// Coupure logicielle de l'étage, transmise au gestionnaire de défauts
+
+static void PowerStageTrip(uint8_t cause, const APP_MEASURE *meas) {
+    faultState = true; // Basculer en erreur (la régulation s'arrête)
+    ShutDownOn(); // Bloquer le driver
+    SetPWMFix(0); // Couper le PWM
+    FaultLog(cause, meas);
+    appData.fault.swCount++;
+    RED_LEDOn(); // Indiquer l'erreur
+    FAULT_Trip(cause);
+}
+
+// Vérification des seuils sécurité (tension + courant)
+
+bool CheckSafety(const APP_MEASURE *meas) {
+    uint8_t cause = 0;
 
-bool CheckSafety(void) {
-    float vout = ReadVout();
-    float iout = ReadIout();
+#if APP_REGUL_FIXED
+    if (meas->vOutCode > MAX_VOUT_CODE) cause |= FAULT_BIT(FAULT_OVP);
+    if (meas->iOutCode > appData.derate.iMaxCode) cause |= FAULT_BIT(FAULT_OCP);
+#else
+    if (meas->vOut > MAX_VOUT) cause |= FAULT_BIT(FAULT_OVP);
+    if (meas->iOut > MAX_IOUT / DERATE_ONE * appData.derate.kQ15)
+        cause |= FAULT_BIT(FAULT_OCP);
+#endif
 
-    if (vout > MAX_VOUT || iout > MAX_IOUT) {
-        RED_LEDOn(); // Indiquer l'erreur
-        SetPWM(0.0f); // Couper le PWM
-        faultState = true; // Basculer en erreur
+    if (cause != 0) {
+        PowerStageTrip(cause, meas);
         return false;
     }
     return true;
 }
 
-// Si l'erreur est passe, redmarrer la rgulation
+// Acquittement d'un défaut matériel signalé par l'ISR OC1 : la sortie
+// est déjà coupée, il ne reste qu'à le journaliser
 
-void SafeRecovery(void) {
-    if (faultState) {
-        float vout = ReadVout();
-        if (vout < TARGET_V * 0.95f) { // Tension redevenue "safe"
-            faultState = false;
-            integrale = 0.0f;
-            SetPWM(0.1f); // Reprise progressive
-            RED_LEDOff(); // teindre alarme
+static void FaultAcknowledge(const APP_MEASURE *meas) {
+    appData.fault.hwPending = false;
+    appData.fault.hwCount++;
+    FaultLog(FAULT_BIT(FAULT_HW), meas);
+    SetPWMFix(0); // Reprise à rapport cyclique nul
+    RED_LEDOn();
+    FAULT_Trip(FAULT_BIT(FAULT_HW));
+}
+
+// Reprise autorisée par le gestionnaire de défauts (temps d'extinction
+// écoulé, cause non verrouillée) : redémarrer si la tension est
+// redevenue "safe"
+
+void SafeRecovery(const APP_MEASURE *meas) {
+#if APP_REGUL_FIXED
+    bool safe = (meas->vOutCode < SAFE_VOUT_CODE);
+#else
+    bool safe = (meas->vOut < TARGET_V * 0.95f);
+#endif
+
+    if (FAULT_Tick(safe)) {
+        // ISR OC1 masquée : un défaut pendant la reprise sera vu à la
+        // restauration, après faultState = false
+        bool enabled = SYS_INT_SourceDisable(INT_SOURCE_OUTPUT_COMPARE_1);
+
+        // OC1 réarmé seulement si le dernier défaut matériel est
+        // acquitté et que l'entrée OCFA est revenue au repos
+        if (!appData.fault.hwPending && PWM_FaultClear()) {
+            SoftStartArm(); // Reprise progressive depuis la tension présente
+            ShutDownOff(); // Libérer le driver
+            RED_LEDOff(); // Éteindre alarme
+            FAULT_Restarted();
+            faultState = false; // En dernier : la régulation reprend
         }
+        SYS_INT_SourceRestore(INT_SOURCE_OUTPUT_COMPARE_1, enabled);
     }
 }
 
-// Fonction principale de rgulation (appele par timer1)
+// Fonction principale de régulation (appelée en fin de séquence ADC,
+// toutes les CTRL_DECIM périodes PWM)
 
 void PI_Regulation(void) {
-    if (faultState) {
-        SafeRecovery(); // Essayer recovery si en erreur
+    APP_MEASURE *meas = &appData.meas;
+
+    APP_Acquire(meas); // Une seule lecture ADC pour toute la période
+
+    if (faultState) { // PWM coupé, la supervision gère la reprise
+        TraceStep(meas);
         return;
     }
 
-    if (!CheckSafety()) return; // Blocage si hors-scurit
+    // Impulsions tronquées par la limitation : la consigne repart de la
+    // tension présente (intégrateurs préchargés, reprise en rampe)
+    if (ILIM_IsActive()) SoftStartArm();
+    if (appData.ss.armed) SoftStartBegin(meas);
+    int32_t ref = SoftStartStep(); // Consigne (codes AN11)
+
+#if APP_REGUL_FIXED
+    int32_t error = ref - (int32_t)meas->vOutCode;
+#if APP_REGUL_CASCADE
+    // Consigne de courant : Q31 de la pleine échelle -> codes AN12
+    q31_t iRef = PI_StepFix(&piParam, &piState, error);
+    error = (int32_t)Q31_Scale(iRef, ADC_MAX + 1) - (int32_t)meas->iOutCode;
+    SetPWMFix(PI_StepFix(&piCurParam, &piCurState, error));
+#elif APP_REGUL_COMP
+    SetPWMFix(COMP_StepFix(&compParam, &compState, error));
+#else
+    SetPWMFix(PI_StepFix(&piParam, &piState, error)); // Appliquer le PWM régulé
+#endif
+#else
+    float error = ref * LSB_VOUT - meas->vOut;
+#if APP_REGUL_CASCADE
+    float iRef = PI_StepFloat(&piParam, &piState, error); // Consigne (A)
+    SetPWM(PI_StepFloat(&piCurParam, &piCurState, iRef - meas->iOut));
+#elif APP_REGUL_COMP
+    SetPWM(COMP_StepFloat(&compRef, &compState, error));
+#else
+    SetPWM(PI_StepFloat(&piParam, &piState, error)); // Appliquer le PWM régulé
+#endif
+#endif
+
+    TraceStep(meas);
+}
+
+// Seuil de la limitation cycle par cycle (A) ; le seuil effectif est
+// publié dans appData.ilim et dans une nouvelle trame INFO
+
+bool APP_CurrentLimitSet(float amps) {
+    if (!ILIM_Configure(amps * SHUNT_GAIN * SHUNT_R))
+        return false;
+    appData.ilim.thresholdmA =
+            (uint16_t)(ILIM_ThresholdGet() / (SHUNT_GAIN * SHUNT_R) * 1000.0f + 0.5f);
+    TELEM_IlimSet(appData.ilim.thresholdmA, ILIM_CountGet());
+    return true;
+}
+
+// Réduction thermique (un tick de supervision) : facteur k à la
+// dernière température du LM92, courant de coupure k.MAX_IOUT et
+// plafond de consigne lu par SoftStartStep(). Hors réduction, pas de
+// repli : la pleine échelle de l'ADC n'est jamais dépassée en moyenne.
+
+static void ThermalDerate(const APP_MEASURE *meas) {
+    static const DERATE_PARAM param = {
+        TEMP_TO_16(TEMP_DERATE_START), TEMP_TO_16(TEMP_DERATE_END), Q15(DERATE_KMIN)
+    };
+    APP_DERATE *d = &appData.derate;
+    uint32_t samples = LM92_SampleCount();
+    int32_t foldCode = (int32_t)ADC_MAX + 1;
+    uint16_t k;
+
+    if (samples != d->samples) {
+        d->samples = samples;
+        d->staleMs = 0;
+        d->temp16 = LM92_Temperature16();
+    } else if (d->staleMs < TEMP_STALE_MS) {
+        d->staleMs += 1000u / SUPERV_FREQ;
+    }
+    d->errors = LM92_ErrorCount();
+
+    // Capteur muet : réduction maximale
+    k = (d->staleMs < TEMP_STALE_MS) ? DERATE_Factor(&param, d->temp16) : param.kMin;
+    if (k + DERATE_K_STEP < d->kQ15) k = d->kQ15 - DERATE_K_STEP; // Descente limitée
+    d->kQ15 = k;
+    d->iMaxCode = (uint16_t)((MAX_IOUT_CODE * (int32_t)d->kQ15) >> 15);
+
+    if (d->kQ15 < DERATE_ONE)
+        foldCode = (d->iMaxCode * (int32_t)Q15(DERATE_FOLD)) >> 15;
+    appData.ss.limitQ16 = DERATE_Fold(&derateState, meas->vOutCode, meas->iOutCode,
+                                      foldCode, appData.ss.targetQ16, DERATE_STEP_Q16);
+}
+
+// Supervision (Timer1, SUPERV_FREQ) : protection puis reprise, sur
+// la dernière mesure de la régulation
+
+void APP_Supervisor(void) {
+    APP_MEASURE meas;
+    bool i2tOver;
+
+    appData.tick++;
+    APP_MeasureGet(&meas);
+    appData.ilim.count = ILIM_CountGet();
+    appData.ilim.active = ILIM_IsActive();
+
+    i2tOver = FAULT_I2tUpdate(meas.iOutCode); // Aussi à l'arrêt : refroidissement
+
+    if (appData.fault.hwPending) {
+        FaultAcknowledge(&meas); // Reprise au plus tôt après l'extinction
+    } else if (faultState) {
+        SafeRecovery(&meas); // Hiccup : reprise ou verrouillage
+    } else if (CheckSafety(&meas)) { // Coupure si hors-sécurité
+        if (i2tOver) PowerStageTrip(FAULT_BIT(FAULT_I2T), &meas);
+        else FAULT_Tick(true); // Marche saine : budget de reprises
+    }
+
+    appData.fault.state = (uint8_t)FAULT_StateGet();
+    appData.fault.latched = FAULT_LatchedGet();
+    appData.fault.i2tPct = FAULT_I2tPercent();
+
+    I2CBUS_Tick(1000u / SUPERV_FREQ); // Relevés I2C périodiques, débits
+    ThermalDerate(&meas);
+
+    // INA226 : publication de la dernière lecture (lancée par ALERT) ;
+    // relance sans attente si aucune mesure n'est arrivée depuis
+    // INA_STALE_MS
+    if (appData.tick % (INA_PERIOD_MS * SUPERV_FREQ / 1000ul) == 0) {
+        uint32_t samples = INA226_SampleCount();
+
+        if (samples != appData.ina.samples) appData.ina.staleMs = 0;
+        else if ((appData.ina.staleMs += INA_PERIOD_MS) >= INA_STALE_MS) {
+            appData.ina.staleMs = 0;
+            appData.ina.kicks++;
+            INA226_Update(); // Relâche aussi ALERT
+        }
+        appData.ina.vBusmV = (uint16_t)(INA226_GetBusVoltage() * 1000.0f + 0.5f);
+        appData.ina.iOutmA = (int16_t)(INA226_GetCurrent(INA_RSHUNT) * 1000.0f);
+        appData.ina.samples = samples;
+        appData.ina.errors = INA226_ErrorCount();
+        appData.ina.alerts = INA226_AlertCount();
+    }
+}
+
+// Démarrage de l'étage de puissance : PWM et ADC en phase, DT déduit de
+// la période PWM réellement obtenue
+
+void APP_RegulationStart(void) {
+    static const SCOPE_CONFIG capture = {
+        CAPTURE_SOURCE, CAPTURE_TRIGGER, CAPTURE_LEVEL, CAPTURE_PRE, CAPTURE_DECIM
+    };
+    float dt;
+
+    PWM_Configure(PWM_FREQ); // PWM_FREQ <= PWM_FREQ_MAX
+    dt = (float)CTRL_DECIM * PWM_PeriodNs() * 1e-9f;
+#if APP_REGUL_FIXED && APP_REGUL_CASCADE
+    // Tension : sortie en fraction de la pleine échelle courant
+    PI_InitFix(&piParam, KP_V / IOUT_FULL, KI_V / IOUT_FULL, dt, LSB_VOUT,
+               0.0f, ILIM / IOUT_FULL);
+    PI_InitFix(&piCurParam, KP_I, KI_I, dt, LSB_IOUT, 0.0f, 1.0f);
+    PI_AntiWindupFix(&piParam, APP_PI_AW, dt, KP_V / KI_V);
+    PI_AntiWindupFix(&piCurParam, APP_PI_AW, dt, KP_I / KI_I);
+#elif APP_REGUL_FIXED
+    PI_InitFix(&piParam, KP, KI, dt, LSB_VOUT, 0.0f, 1.0f);
+    PI_AntiWindupFix(&piParam, APP_PI_AW, dt, KP / KI);
+#else
+    piParam.dt = dt;
+#if APP_REGUL_CASCADE
+    piCurParam.dt = dt;
+    PI_AntiWindupFloat(&piParam, APP_PI_AW, KP_V / KI_V);
+    PI_AntiWindupFloat(&piCurParam, APP_PI_AW, KP_I / KI_I);
+#else
+    PI_AntiWindupFloat(&piParam, APP_PI_AW, KP / KI);
+#endif
+#endif
+
+    // Rampe : incrément par pas, en codes Q16.16
+    appData.ss.targetQ16 = TARGET_V_CODE << 16;
+    appData.ss.stepQ16 = (int32_t)(SS_SLEW * dt / LSB_VOUT * 65536.0f);
+    if (appData.ss.stepQ16 < 1) appData.ss.stepQ16 = 1;
+    appData.ss.active = false;
+    DERATE_Init(&derateState, appData.ss.targetQ16);
+    appData.ss.limitQ16 = appData.ss.targetQ16;
+    appData.derate.kQ15 = DERATE_ONE;
+    appData.derate.iMaxCode = MAX_IOUT_CODE;
+    SoftStartArm();
+
+    FAULT_Init(faultPolicy, FAULT_GOOD_MS * SUPERV_FREQ / 1000ul,
+               I2T_NOM_CODE2, I2T_LIMIT_CODE2);
+
+    // Timer1 (prescaler Harmony) : période de supervision
+    DRV_TMR0_PeriodValueSet(DRV_TMR0_CounterFrequencyGet() / SUPERV_FREQ - 1);
+
+    APP_CurrentLimitSet(IPEAK_LIM);
+    SetPWMFix(0);
+    TelemetryStart();
+    SCOPE_Arm(&capture);
+
+    // Budgets du profileur : période de chaque ISR
+    PROFILE_BudgetSet(PROFILE_REGUL, PROFILE_NS_TO_TICKS(PWM_PeriodNs() * CTRL_DECIM));
+    PROFILE_BudgetSet(PROFILE_PWM, PROFILE_NS_TO_TICKS(PWM_PeriodNs()));
+    PROFILE_BudgetSet(PROFILE_SUPERV, PROFILE_NS_TO_TICKS(1000000000ul / SUPERV_FREQ));
+    PWM_SyncStart(ADC_TRIG_POINT, CTRL_DECIM);
+}
+
+// Démarrage du moniteur INA226 : conversion continue, ALERT en fin de
+// mesure et au-delà de INA_ALERT_A (verrouillée jusqu'à la lecture de
+// Mask/Enable, un front par mesure même en surintensité durable)
+// Appelé depuis la boucle principale alors que les ISR I2C1 et change
+// notification sont déjà validées : elles sont masquées le temps de
+// remplir les files, qu'elles manipulent aussi (voir ina226.h).
 
-    float Vout = ReadVout();
-    float error = TARGET_V - Vout;
+void APP_MonitorStart(void) {
+    bool i2cEnabled = SYS_INT_SourceDisable(INT_SOURCE_I2C_1_MASTER);
+    bool cnEnabled = SYS_INT_SourceDisable(INT_SOURCE_CHANGE_NOTICE_B);
 
-    integrale += error * DT; // Accumuler erreur pour le I
+    I2CBUS_Initialize(); // Ordonnanceur du bus I2C1, avant ses clients
+    INA226_Initialize();
+    INA226_AlertConfigure(INA226_MASK_SOL | INA226_MASK_LEN, INA_ALERT_CODE);
+    LM92_Initialize(TEMP_PERIOD_MS);
 
-    float output = KP * error + KI * integrale;
+    SYS_INT_SourceRestore(INT_SOURCE_CHANGE_NOTICE_B, cnEnabled);
+    SYS_INT_SourceRestore(INT_SOURCE_I2C_1_MASTER, i2cEnabled);
+}
 
-    // Saturation de la sortie (entre 0 et 1)
-    if (output > 1.0f) output = 1.0f;
-    if (output < 0.0f) output = 0.0f;
+// Callback appelé par le timer1 : tâches lentes
 
-    SetPWM(output); // Appliquer le PWM rgul
+void App_Timer0Callback(void) {
+    PROFILE_BEGIN(PROFILE_SUPERV);
+    APP_Supervisor();
+    PROFILE_END(PROFILE_SUPERV);
 }
 
-// Callback appel par le timer1 (toutes les 100 s)
+// Callback appelé par le timer2 en début de période PWM (interruption
+// validée seulement pendant la limitation de courant : la régulation est
+// cadencée par la fin de conversion ADC)
 
 void App_Timer1Callback() {
+    PROFILE_BEGIN(PROFILE_PWM);
+    ILIM_PeriodStart();
+    PROFILE_END(PROFILE_PWM);
+}
+
+// Callback appelé par le comparateur 1 : courant au-delà du seuil crête
 
+void App_CmpCallback(void) {
+    ILIM_Trip();
+}
+
+// Callback appelé en fin de séquence ADC (Vout vient d'être converti)
+
+void App_AdcCallback(void) {
+    PROFILE_BEGIN(PROFILE_REGUL);
     PI_Regulation();
+    PROFILE_END(PROFILE_REGUL);
+}
+
+// Callback appelé par la change notification du port B (priorité 1) :
+// la lecture de RB7 termine le mismatch ; ALERT basse = nouvelle mesure
+// (ou fonction d'alerte) de l'INA226
+
+void App_AlertCallback(void) {
+    if (!ALERTStateGet()) INA226_AlertEvent();
 }
 
-/*************************************************/
-/*************************************************/
-/*************************************************/
-/*****   fonction de transfert en Z de PID   *****/
-
-// Dclaration des constantes du filtre
-#define a1  2.13
-#define a2 -1.83
-#define b0  0.24
-#define b1 -0.24
-// Dclaration des variables statiques pour mmoriser l'tat du filtre
-static float x_k_1 = 0.0f; // x(k-1)
-static float y_k_1 = 0.0f; // y(k-1)
-static float y_k_2 = 0.0f; // y(k-2)
-// Fonction du filtre  appeler  chaque nouvel chantillon
-
-float PIDMine(float x_k) {
-    float y_k;
-    // Calcul du filtre
-    y_k = a1 * y_k_1 + a2 * y_k_2 + b0 * x_k + b1 * x_k_1;
-    // Mise  jour des anciennes valeurs pour la prochaine itration
-    x_k_1 = x_k;
-    y_k_2 = y_k_1;
-    y_k_1 = y_k;
-    // Retourner la sortie courante
-    return y_k;
+// Callback appelé par OC1 (priorité 7) sur défaut OCFA : la sortie PWM
+// est déjà forcée à zéro par le matériel
 
+void App_OcFaultCallback(void) {
+    ShutDownOn(); // Driver bloqué jusqu'à la reprise
+    faultState = true; // La régulation s'arrête
+    appData.fault.hwPending = true; // Acquittement par la supervision
 }
+
 /*******************************************************************************
  End of File
  *******************************************************************************/
@@ -58,6 +58,8 @@ SUBSTITUTE GOODS, TECHNOLOGY, SERVICES, OR ANY CLAIMS BY THIRD PARTIES
 #include <stdlib.h>
 #include "system_config.h"
 #include "system_definitions.h"
+#include "fixmath.h"
+#include "fault.h"
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
@@ -96,6 +98,162 @@ typedef enum
 } APP_STATES;
 
 
+// === Choix du moteur de régulation (à la compilation) ===
+// 1 : virgule fixe Q31 (aucun calcul flottant dans l'ISR)
+// 0 : référence flottante (soft-float, conservée pour comparaison)
+#ifndef APP_REGUL_FIXED
+#define APP_REGUL_FIXED 1
+#endif
+
+// === Structure de la régulation (à la compilation) ===
+// 0 : PI de tension unique (Vout -> rapport cyclique)
+// 1 : cascade, boucle de tension externe -> consigne de courant,
+//     boucle de courant interne sur AN12 -> rapport cyclique
+#ifndef APP_REGUL_CASCADE
+#define APP_REGUL_CASCADE 0
+#endif
+
+// === Loi de la boucle de tension (hors cascade) ===
+// 0 : PI (regul.c)
+// 1 : compensateur 2P2Z / 3P3Z (comp.c)
+#ifndef APP_REGUL_COMP
+#define APP_REGUL_COMP 0
+#endif
+
+// *****************************************************************************
+/* Mesures d'une période de régulation
+
+  Summary:
+    Photographie unique des entrées analogiques pour un tick
+
+  Description:
+    Les codes sont lus une seule fois par APP_Acquire() au début de
+    PI_Regulation. La supervision (protection, reprise), plus lente, en
+    prend une copie cohérente avec APP_MeasureGet().
+*/
+
+typedef struct
+{
+    uint16_t vOutCode;      // Code ADC AN11 (tension de sortie)
+    uint16_t iOutCode;      // Code ADC AN12 (courant de sortie)
+#if !APP_REGUL_FIXED
+    float vOut;             // Conversions faites une seule fois (V)
+    float iOut;             // (A)
+#endif
+} APP_MEASURE;
+
+// *****************************************************************************
+/* Démarrage progressif
+
+  Summary:
+    Rampe de consigne de tension (codes AN11, Q16.16)
+
+  Description:
+    Armée par APP_RegulationStart() et par la reprise après défaut ; le
+    pas de régulation suivant capture la tension présente, précharge les
+    régulateurs et fait monter la consigne de stepQ16 par pas jusqu'à
+    targetQ16.
+*/
+
+typedef struct
+{
+    int32_t refQ16;         // Consigne courante
+    int32_t targetQ16;      // Consigne finale (TARGET_V)
+    int32_t stepQ16;        // Incrément par pas de régulation
+    volatile int32_t limitQ16; // Plafond (repli thermique, supervision)
+    volatile bool armed;    // Capture de la pré-charge au prochain pas
+    bool active;            // Rampe en cours
+} APP_SOFTSTART;
+
+// *****************************************************************************
+/* Journal des défauts
+
+  Summary:
+    Coupures de l'étage de puissance
+
+  Description:
+    Un défaut matériel (entrée OCFA de OC1, active basse) force la sortie
+    PWM à zéro sans intervention du logiciel ; l'ISR OC1 (priorité 7)
+    bloque en plus le driver par ShutDown et le signale. La supervision
+    l'acquitte et le journalise, comme les coupures logicielles de
+    CheckSafety. La reprise est décidée par le gestionnaire de défauts
+    (fault.h) dont l'état est recopié ici à chaque tick.
+*/
+
+typedef struct
+{
+    volatile bool hwPending;    // Défaut matériel à acquitter (ISR OC1)
+    uint8_t  cause;             // Masque FAULT_BIT() du dernier défaut
+    uint8_t  state;             // FAULT_STATE
+    uint8_t  latched;           // Causes verrouillées
+    uint8_t  i2tPct;            // Remplissage de l'accumulateur I²t (%)
+    uint16_t hwCount;           // Coupures matérielles
+    uint16_t swCount;           // Coupures logicielles
+    uint32_t tick;              // Tick de supervision du dernier défaut
+    APP_MEASURE meas;           // Mesure au moment du défaut
+} APP_FAULT_LOG;
+
+// *****************************************************************************
+/* Limitation de courant cycle par cycle
+
+  Summary:
+    Etat publié par la supervision (télémétrie)
+
+  Description:
+    Seuil effectif (arrondi au niveau de CVREF) et impulsions tronquées
+    depuis le démarrage, recopiés à chaque tick depuis ilim.c.
+*/
+
+typedef struct
+{
+    uint16_t thresholdmA;       // Seuil crête effectif (mA)
+    uint32_t count;             // Impulsions tronquées
+    bool     active;            // Limitation en cours
+} APP_ILIM;
+
+// *****************************************************************************
+/* Mesures INA226
+
+  Summary:
+    Dernière paire bus/shunt lue par l'INA226 (I2C, non bloquant)
+
+  Description:
+    Lue à chaque fin de mesure signalée par ALERT (RB7) ; publiée par la
+    supervision toutes les INA_PERIOD_MS.
+*/
+
+typedef struct
+{
+    uint16_t vBusmV;            // Tension de bus (mV)
+    int16_t  iOutmA;            // Courant dans le shunt de l'INA226 (mA)
+    uint32_t samples;           // Paires lues
+    uint32_t errors;            // Accès non acquittés
+    uint32_t alerts;            // Surintensités signalées (AFF)
+    uint32_t kicks;             // Relances sans ALERT
+    uint16_t staleMs;           // Temps sans nouvelle mesure (ms)
+} APP_INA;
+
+// *****************************************************************************
+/* Réduction thermique
+
+  Summary:
+    Température de carte (LM92) et courant admissible qui en découle
+
+  Description:
+    Mis à jour à chaque tick de supervision par ThermalDerate() ; le
+    plafond de consigne correspondant est dans APP_SOFTSTART.limitQ16.
+*/
+
+typedef struct
+{
+    int16_t  temp16;            // Dernière température (1/16 °C)
+    uint16_t kQ15;              // Facteur de réduction (Q15, 1.0 : aucune)
+    uint16_t iMaxCode;          // Courant de coupure (codes AN12)
+    uint16_t staleMs;           // Temps sans nouvelle mesure (ms)
+    uint32_t samples;           // Lectures du LM92
+    uint32_t errors;            // Lectures non acquittées
+} APP_DERATE;
+
 // *****************************************************************************
 /* Application Data
 
@@ -114,6 +272,27 @@ typedef struct
     /* The application's current state */
     APP_STATES state;
 
+    /* Dernière acquisition (écrite par l'ISR de régulation) */
+    APP_MEASURE meas;
+
+    /* Consigne de tension (rampe de démarrage) */
+    APP_SOFTSTART ss;
+
+    /* Ticks de supervision (SUPERV_FREQ) */
+    uint32_t tick;
+
+    /* Coupures de l'étage de puissance */
+    APP_FAULT_LOG fault;
+
+    /* Limitation de courant cycle par cycle */
+    APP_ILIM ilim;
+
+    /* Moniteur INA226 */
+    APP_INA ina;
+
+    /* Réduction thermique (LM92) */
+    APP_DERATE derate;
+
     /* TODO: Define any additional data used by the application. */
 
 } APP_DATA;
@@ -166,21 +345,28 @@ typedef struct
 
 void APP_Initialize ( void );
 
+void App_Timer0Callback(void);
 void App_Timer1Callback(void);
+void App_AdcCallback(void);
+void App_OcFaultCallback(void);
+void App_CmpCallback(void);
+void App_AlertCallback(void);
+void APP_RegulationStart(void);
+void APP_MonitorStart(void);
+void APP_Supervisor(void);
 void APP_UpdateState(APP_STATES Newstate);
 
-// === Rgulation et lecture ===
+// === Régulation et lecture ===
 void PI_Regulation(void);
 void SetPWM(float duty);
+void SetPWMFix(q31_t duty);
 float ReadVout(void);
 float ReadIout(void);
-//void PIDMine (float);
-
-// === Prototypes INA226 ===
-uint16_t INA226_ReadRegister(uint8_t reg);
-float INA226_GetBusVoltage(void);
-float INA226_GetShuntVoltage(void);
-float INA226_GetCurrent(float Rshunt);
+uint16_t ReadVoutCode(void);
+uint16_t ReadIoutCode(void);
+void APP_Acquire(APP_MEASURE *meas);
+void APP_MeasureGet(APP_MEASURE *meas);
+bool APP_CurrentLimitSet(float amps);
 
 #define ZERO 0
 #define TEST 80 
@@ -0,0 +1,165 @@
+//--------------------------------------------------------
+//      comp.c
+//--------------------------------------------------------
+//	Description :	Compensateur numérique 2P2Z / 3P3Z
+//                  Voir comp.h pour l'équation et les formats.
+//--------------------------------------------------------
+
+#include "comp.h"
+
+#define COMP_SHIFT_MAX  8           // |coef| < 256
+
+//------------------------------------------------------------------------------
+// Référence flottante
+
+void COMP_ResetFloat(COMP_FLOAT_STATE *s)
+{
+    uint8_t i;
+
+    for (i = 0; i < COMP_ORDER_MAX; i++)
+    {
+        s->x[i] = 0.0f;
+        s->y[i] = 0.0f;
+    }
+}
+
+void COMP_PreloadFloat(COMP_FLOAT_STATE *s, float out)
+{
+    uint8_t i;
+
+    for (i = 0; i < COMP_ORDER_MAX; i++)
+    {
+        s->x[i] = 0.0f;
+        s->y[i] = out;
+    }
+}
+
+float COMP_StepFloat(const COMP_FLOAT_PARAM *p, COMP_FLOAT_STATE *s, float error)
+{
+    float output = p->b[0] * error;
+    int8_t i;
+
+    for (i = 0; i < p->type; i++)
+        output += p->b[i + 1] * s->x[i] + p->a[i + 1] * s->y[i];
+
+    // Saturation de la sortie (valeur mémorisée)
+    if (output > p->outMax) output = p->outMax;
+    if (output < p->outMin) output = p->outMin;
+
+    for (i = p->type - 1; i > 0; i--)
+    {
+        s->x[i] = s->x[i - 1];
+        s->y[i] = s->y[i - 1];
+    }
+    s->x[0] = error;
+    s->y[0] = output;
+
+    return output;
+}
+
+//------------------------------------------------------------------------------
+// Version virgule fixe
+
+static float _Abs(float x)
+{
+    return (x < 0.0f) ? -x : x;
+}
+
+bool COMP_InitFix(COMP_FIX_PARAM *p, const COMP_FLOAT_PARAM *ref, float lsb)
+{
+    float cMax = 0.0f;
+    float aSum = 0.0f;
+    float scale;
+    int64_t aFix = 0;
+    uint8_t i, shift;
+
+    // Plus grand coefficient -> format commun
+    for (i = 0; i <= ref->type; i++)
+    {
+        if (_Abs(ref->b[i] * lsb) > cMax) cMax = _Abs(ref->b[i] * lsb);
+        if (i > 0 && _Abs(ref->a[i]) > cMax) cMax = _Abs(ref->a[i]);
+        if (i > 0) aSum += ref->a[i];
+    }
+    // Intégrateur : 1 doit être représentable, shift >= 1
+    shift = (_Abs(aSum - 1.0f) < 1e-6f) ? 1 : 0;
+    for (; shift <= COMP_SHIFT_MAX; shift++)
+    {
+        if (cMax < (float)(1ul << shift))
+            break;
+    }
+    if (shift > COMP_SHIFT_MAX)
+        return false;
+
+    scale = 1.0f / (float)(1ul << shift);
+    p->type = ref->type;
+    p->shift = shift;
+    p->a[0] = 0;
+    for (i = 0; i <= COMP_ORDER_MAX; i++)
+    {
+        p->b[i] = (i <= ref->type) ? Q31(ref->b[i] * lsb * scale) : 0;
+        if (i > 0)
+            p->a[i] = (i <= ref->type) ? Q31(ref->a[i] * scale) : 0;
+    }
+    // Intégrateur (somme des a égale à 1) : a1 corrigé pour que la somme
+    // quantifiée soit exacte, sinon le pôle en z = 1 fuit ou diverge
+    if (_Abs(aSum - 1.0f) < 1e-6f)
+    {
+        for (i = 2; i <= ref->type; i++)
+            aFix += p->a[i];
+        p->a[1] = (q31_t)(((int64_t)1 << (31 - shift)) - aFix);
+    }
+    p->outMin = Q31(ref->outMin);
+    p->outMax = Q31(ref->outMax);
+    return true;
+}
+
+void COMP_ResetFix(COMP_FIX_STATE *s)
+{
+    uint8_t i;
+
+    for (i = 0; i < COMP_ORDER_MAX; i++)
+    {
+        s->x[i] = 0;
+        s->y[i] = 0;
+    }
+}
+
+void COMP_PreloadFix(COMP_FIX_STATE *s, q31_t out)
+{
+    uint8_t i;
+
+    for (i = 0; i < COMP_ORDER_MAX; i++)
+    {
+        s->x[i] = 0;
+        s->y[i] = out;
+    }
+}
+
+// Accumulation en Q(31-shift) sur 64 bits : b.x est déjà à ce format
+// (x entier), a.y (Q31 x Q(31-shift)) est ramené par >> 31. Aucun
+// débordement possible : |terme| < 2^31 . 1024.
+
+q31_t COMP_StepFix(const COMP_FIX_PARAM *p, COMP_FIX_STATE *s, int32_t errorCode)
+{
+    int64_t acc = (int64_t)p->b[0] * errorCode;
+    q31_t output;
+    int8_t i;
+
+    for (i = 0; i < p->type; i++)
+    {
+        acc += (int64_t)p->b[i + 1] * s->x[i];
+        acc += ((int64_t)p->a[i + 1] * s->y[i]) >> 31;
+    }
+
+    output = Q31_Limit(Q31_Sat(acc * (1l << p->shift)), p->outMin, p->outMax);
+
+    for (i = p->type - 1; i > 0; i--)
+    {
+        s->x[i] = s->x[i - 1];
+        s->y[i] = s->y[i - 1];
+    }
+    s->x[0] = errorCode;
+    s->y[0] = output;
+
+    return output;
+}
@@ -0,0 +1,90 @@
+//--------------------------------------------------------
+//      comp.h
+//--------------------------------------------------------
+//	Description :	Compensateur numérique 2P2Z / 3P3Z (fixe Q31 et
+//                  référence float), généralise l'ancien PIDMine
+//
+//  Equation aux différences (convention de PIDMine, N = 2 ou 3) :
+//      y(k) = b0.x(k) + b1.x(k-1) + ... + bN.x(k-N)
+//           + a1.y(k-1) + ... + aN.y(k-N)
+//  soit C(z) = (b0 + b1.z^-1 + ...) / (1 - a1.z^-1 - ... - aN.z^-N)
+//
+//  Version fixe :
+//      x : erreur en codes ADC (entier), y : sortie Q31
+//      coefficients Q(31-shift) : valeur réelle = c / 2^(31-shift),
+//      shift choisi pour que |coef| < 2^shift (les a d'un intégrateur
+//      ou d'un type III dépassent 1). Les b incluent le LSB de l'erreur
+//      (sortie Q31 par code), comme les gains de PI_FIX_PARAM.
+//      La sortie est bornée à [outMin, outMax] et c'est la valeur
+//      bornée qui est mémorisée : un pôle en z = 1 ne s'emballe pas.
+//  Coût : 2N+1 MULT 32x32->64, aucun appel de bibliothèque
+//--------------------------------------------------------
+
+#ifndef COMP_H
+#define COMP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "fixmath.h"
+
+#define COMP_ORDER_MAX  3
+
+typedef enum
+{
+    COMP_2P2Z = 2,
+    COMP_3P3Z = 3
+} COMP_TYPE;
+
+// Conversion d'un coefficient constant en Q(31-shift)
+#define COMP_Q(x, shift)    Q31((x) / (double)(1ul << (shift)))
+
+// === Référence flottante ===
+typedef struct
+{
+    COMP_TYPE type;
+    float b[COMP_ORDER_MAX + 1];        // b0..bN
+    float a[COMP_ORDER_MAX + 1];        // a[0] inutilisé, a1..aN
+    float outMin;
+    float outMax;
+} COMP_FLOAT_PARAM;
+
+typedef struct
+{
+    float x[COMP_ORDER_MAX];            // x(k-1)..x(k-N)
+    float y[COMP_ORDER_MAX];            // y(k-1)..y(k-N)
+} COMP_FLOAT_STATE;
+
+// === Virgule fixe ===
+typedef struct
+{
+    COMP_TYPE type;
+    uint8_t   shift;                    // Format Q(31-shift) des coefficients
+    q31_t     b[COMP_ORDER_MAX + 1];    // b0..bN (x LSB de l'erreur)
+    q31_t     a[COMP_ORDER_MAX + 1];    // a[0] inutilisé, a1..aN
+    q31_t     outMin;                   // Limite basse de la sortie (Q31)
+    q31_t     outMax;                   // Limite haute de la sortie (Q31)
+} COMP_FIX_PARAM;
+
+typedef struct
+{
+    int32_t x[COMP_ORDER_MAX];          // Erreurs passées (codes)
+    q31_t   y[COMP_ORDER_MAX];          // Sorties passées (Q31)
+} COMP_FIX_STATE;
+
+// Conversion des coefficients réels (b0..bN, a1..aN dans a[1..N]) ;
+// lsb : unité physique d'un code de l'erreur. Calcul en flottant, à
+// faire une fois hors ISR. Faux si un coefficient dépasse 2^8.
+bool  COMP_InitFix(COMP_FIX_PARAM *p, const COMP_FLOAT_PARAM *ref, float lsb);
+
+// Préchargement : historique de sortie à 'out', erreurs passées nulles.
+// Point d'équilibre exact si le compensateur contient un intégrateur.
+void  COMP_PreloadFloat(COMP_FLOAT_STATE *s, float out);
+void  COMP_PreloadFix(COMP_FIX_STATE *s, q31_t out);
+
+void  COMP_ResetFloat(COMP_FLOAT_STATE *s);
+float COMP_StepFloat(const COMP_FLOAT_PARAM *p, COMP_FLOAT_STATE *s, float error);
+
+void  COMP_ResetFix(COMP_FIX_STATE *s);
+q31_t COMP_StepFix(const COMP_FIX_PARAM *p, COMP_FIX_STATE *s, int32_t errorCode);
+
+#endif
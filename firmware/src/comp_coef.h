@@ -0,0 +1,37 @@
+//--------------------------------------------------------
+//      comp_coef.h
+//--------------------------------------------------------
+//	Description :	Coefficients du compensateur de tension
+//                  GENERE par tp4_design, ne pas modifier :
+//                  make -C firmware/host coef COEF_ARGS="..."
+//
+//  Commande : -f 10000 -c 800 -m 50 -d 0.75 -o ../src/comp_coef.h
+//  Procédé : buck, Vin 12 V, Vout 5 V, L 0.00022 H, rl 0.1 ohm,
+//            C 0.00047 F, ESR 0.05 ohm, charge 10 ohm
+//  Echantillonnage 10000 Hz, retard de calcul 0.75 T
+//  Visé  : fc 800 Hz, marge de phase 50.0°
+//  Obtenu : fc 802 Hz, marge de phase 49.9°, marge de gain 9.0 dB
+//--------------------------------------------------------
+
+#ifndef COMP_COEF_H
+#define COMP_COEF_H
+
+#include "comp.h"
+
+#define COMP_COEF_FS_HZ     10000ul   // Cadence de régulation
+
+// Référence flottante (erreur en V)
+#define COMP_COEF_FLOAT \
+    { COMP_3P3Z, \
+      { 0.266910553f, -0.236258566f, -0.266030520f, 0.237138584f }, \
+      { 0.00000000f, 0.275120854f, 0.593516707f, 0.131362453f }, \
+      0.00000000f, 1.00000000f }
+
+// Virgule fixe (erreur en codes de 0.00987097 V, coefficients Q30)
+#define COMP_COEF_FIX \
+    { COMP_3P3Z, 1, \
+      { 2828951, -2504074, -2819623, 2513401 }, \
+      { 0, 295408752, 637283712, 141049360 }, \
+      0, 2147483647 }
+
+#endif
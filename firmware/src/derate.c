@@ -0,0 +1,54 @@
+//--------------------------------------------------------
+//      derate.c
+//--------------------------------------------------------
+//	Description :	Réduction thermique et repli (voir derate.h)
+//--------------------------------------------------------
+
+#include "derate.h"
+
+uint16_t DERATE_Factor(const DERATE_PARAM *p, int16_t t16)
+{
+    int32_t span = (int32_t)p->tEnd - p->tStart;
+    int32_t drop = (int32_t)DERATE_ONE - p->kMin;
+
+    if (t16 <= p->tStart)
+        return DERATE_ONE;
+    if (t16 >= p->tEnd)
+        return p->kMin;
+    // drop < 2^15, écart < 2^16 : produit sur 31 bits
+    return (uint16_t)(DERATE_ONE - drop * (t16 - p->tStart) / span);
+}
+
+void DERATE_Init(DERATE_STATE *s, int32_t targetQ16)
+{
+    s->vAvg = 0;
+    s->iAvg = 0;
+    s->limitQ16 = targetQ16;
+}
+
+int32_t DERATE_Fold(DERATE_STATE *s, uint16_t vCode, uint16_t iCode,
+                    int32_t iLimCode, int32_t targetQ16, int32_t stepQ16)
+{
+    int32_t iLim = iLimCode << DERATE_AVG_SHIFT;
+
+    s->vAvg += (((int32_t)vCode << DERATE_AVG_SHIFT) - s->vAvg) >> DERATE_AVG_SHIFT;
+    s->iAvg += (((int32_t)iCode << DERATE_AVG_SHIFT) - s->iAvg) >> DERATE_AVG_SHIFT;
+
+    if (s->iAvg > iLim)
+    {
+        // Rapport iLim / iMoy < 1 en Q15 ; codes 10 bits << 4 : 14 bits,
+        // produit vMoy.rapport sur 29 bits, ramené en Q16.16
+        int32_t ratio = (iLim << 15) / s->iAvg;
+        int32_t limit = (s->vAvg * ratio) >> (15 + DERATE_AVG_SHIFT - 16);
+
+        if (limit < s->limitQ16)
+            s->limitQ16 = limit;
+    }
+    else if (s->iAvg < iLim - (iLim >> 5))
+    {
+        s->limitQ16 += stepQ16;
+    }
+    if (s->limitQ16 > targetQ16)
+        s->limitQ16 = targetQ16;
+    return s->limitQ16;
+}
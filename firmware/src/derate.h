@@ -0,0 +1,51 @@
+//--------------------------------------------------------
+//      derate.h
+//--------------------------------------------------------
+//	Description :	Réduction thermique du courant admissible et
+//                  repli de la consigne de tension
+//                  Arithmétique entière, cadencée par la supervision.
+//
+//  Facteur k (Q15) : 1.0 jusqu'à tStart, puis décroissance linéaire
+//  jusqu'à kMin à tEnd, kMin au-delà. Le courant admissible vaut
+//  k.Imax ; l'appelant l'applique à sa protection.
+//
+//  Repli : la consigne de tension est plafonnée pour que le courant de
+//  sortie (moyenné sur 16 ticks) reste sous iLim. Sur charge résistive,
+//  la limite vMoy.iLim/iMoy est la tension qui donne exactement iLim :
+//  une surcharge est ramenée en un tick. Sous iLim (avec une marge de
+//  1/32), la limite remonte de stepQ16 par tick jusqu'à la consigne
+//  nominale.
+//--------------------------------------------------------
+
+#ifndef DERATE_H
+#define DERATE_H
+
+#include <stdint.h>
+
+#define DERATE_ONE          32768u  // k = 1.0 (Q15)
+#define DERATE_AVG_SHIFT    4       // Moyennes sur 2^4 ticks
+
+typedef struct
+{
+    int16_t  tStart;        // Début de la réduction (1/16 °C)
+    int16_t  tEnd;          // Réduction maximale (1/16 °C), > tStart
+    uint16_t kMin;          // Facteur à tEnd et au-delà (Q15)
+} DERATE_PARAM;
+
+typedef struct
+{
+    int32_t  vAvg;          // Moyennes (codes << DERATE_AVG_SHIFT)
+    int32_t  iAvg;
+    int32_t  limitQ16;      // Plafond de consigne (codes, Q16.16)
+} DERATE_STATE;
+
+uint16_t DERATE_Factor(const DERATE_PARAM *p, int16_t t16);
+
+void     DERATE_Init(DERATE_STATE *s, int32_t targetQ16);
+
+// Un tick : mesures (codes ADC 10 bits), courant admissible iLimCode,
+// consigne nominale ; retourne le plafond de consigne
+int32_t  DERATE_Fold(DERATE_STATE *s, uint16_t vCode, uint16_t iCode,
+                     int32_t iLimCode, int32_t targetQ16, int32_t stepQ16);
+
+#endif
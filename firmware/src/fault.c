@@ -0,0 +1,143 @@
+//--------------------------------------------------------
+//      fault.c
+//--------------------------------------------------------
+//	Description :	Gestion des défauts en mode hiccup
+//                  Voir fault.h pour les états et l'I²t.
+//--------------------------------------------------------
+
+#include "fault.h"
+
+static const FAULT_POLICY *faultPolicy;
+static FAULT_STATE faultSt;
+static uint8_t  faultCause;                 // Coupure en cours
+static uint8_t  faultLatched;
+static uint8_t  retriesLeft[FAULT_CAUSE_NB];
+static uint16_t offLeft;                    // Ticks d'extinction restants
+static uint32_t goodTicks;
+static uint32_t goodCount;                  // Ticks de marche sans défaut
+static int32_t  i2tNom;                     // iNom² (codes²)
+static int32_t  i2tLimit;
+static int32_t  i2tAcc;
+
+static void _Refill(void)
+{
+    uint8_t c;
+
+    for (c = 0; c < FAULT_CAUSE_NB; c++)
+        retriesLeft[c] = faultPolicy[c].retries;
+}
+
+void FAULT_Init(const FAULT_POLICY *policy, uint32_t good,
+                int32_t nom, int32_t limit)
+{
+    faultPolicy = policy;
+    goodTicks = good;
+    i2tNom = nom;
+    i2tLimit = limit;
+    i2tAcc = 0;
+    faultSt = FAULT_RUN;
+    faultCause = 0;
+    faultLatched = 0;
+    goodCount = 0;
+    _Refill();
+}
+
+void FAULT_Trip(uint8_t causes)
+{
+    uint8_t c;
+
+    if (faultSt == FAULT_LATCHED)
+        return;
+
+    faultCause = causes;
+    offLeft = 0;
+    goodCount = 0;
+    for (c = 0; c < FAULT_CAUSE_NB; c++)
+    {
+        if (!(causes & FAULT_BIT(c)))
+            continue;
+        if (retriesLeft[c] == 0)
+            faultLatched |= FAULT_BIT(c);   // Budget épuisé
+        else
+            retriesLeft[c]--;
+        if (faultPolicy[c].offTicks > offLeft)
+            offLeft = faultPolicy[c].offTicks;
+    }
+    faultSt = (faultLatched != 0) ? FAULT_LATCHED : FAULT_OFF;
+}
+
+bool FAULT_Tick(bool safe)
+{
+    switch (faultSt)
+    {
+        case FAULT_RUN:
+            if (goodCount < goodTicks && ++goodCount == goodTicks)
+                _Refill(); // Fonctionnement sain : budget rendu
+            return false;
+
+        case FAULT_OFF:
+            if (offLeft > 0)
+            {
+                offLeft--;
+                return false;
+            }
+            if ((faultCause & FAULT_BIT(FAULT_I2T)) && i2tAcc > i2tLimit / 2)
+                return false; // Refroidissement
+            return safe;
+
+        default:
+            return false;
+    }
+}
+
+void FAULT_Restarted(void)
+{
+    if (faultSt == FAULT_OFF)
+    {
+        faultSt = FAULT_RUN;
+        faultCause = 0;
+    }
+}
+
+bool FAULT_I2tUpdate(uint16_t iCode)
+{
+    i2tAcc += (int32_t)iCode * iCode - i2tNom;
+    if (i2tAcc < 0)
+        i2tAcc = 0;
+    if (i2tAcc > 2 * i2tLimit)
+        i2tAcc = 2 * i2tLimit; // Pas de débordement sous surcharge longue
+    return i2tAcc > i2tLimit;
+}
+
+void FAULT_Reset(void)
+{
+    faultLatched = 0;
+    _Refill();
+    if (faultSt == FAULT_LATCHED)
+    {
+        faultSt = FAULT_OFF;
+        offLeft = 0;
+    }
+}
+
+FAULT_STATE FAULT_StateGet(void)
+{
+    return faultSt;
+}
+
+uint8_t FAULT_CauseGet(void)
+{
+    return faultCause;
+}
+
+uint8_t FAULT_LatchedGet(void)
+{
+    return faultLatched;
+}
+
+uint8_t FAULT_I2tPercent(void)
+{
+    int32_t pct = (int32_t)((int64_t)i2tAcc * 100 / i2tLimit);
+
+    return (uint8_t)(pct > 200 ? 200 : pct);
+}
@@ -0,0 +1,82 @@
+//--------------------------------------------------------
+//      fault.h
+//--------------------------------------------------------
+//	Description :	Gestion des défauts en mode hiccup
+//                  (verrouillage par cause, budget de reprises, I²t)
+//
+//  Cadencé par la supervision (FAULT_Tick à chaque tick) :
+//      FAULT_RUN      étage en marche
+//      FAULT_OFF      coupé : attente du temps d'extinction de la cause
+//                     la plus lente, puis des conditions de reprise
+//      FAULT_LATCHED  coupé définitivement, jusqu'à FAULT_Reset()
+//
+//  Chaque coupure consomme une reprise du budget de chacune de ses
+//  causes ; une cause sans reprise restante verrouille l'étage. Le
+//  budget est rendu après goodTicks de marche sans défaut : seule une
+//  série de défauts rapprochés mène au verrouillage.
+//
+//  I²t : acc += i² - iNom² à chaque tick (codes ADC), borné à zéro. Un
+//  appel de courant bref ne fait que remplir l'accumulateur, une
+//  surcharge soutenue le fait dépasser la limite. Après une coupure
+//  I²t, la reprise attend en plus que l'accumulateur soit redescendu
+//  sous la moitié de la limite (refroidissement).
+//--------------------------------------------------------
+
+#ifndef FAULT_H
+#define FAULT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef enum
+{
+    FAULT_OVP = 0,          // Surtension (supervision)
+    FAULT_OCP,              // Surintensité instantanée (supervision)
+    FAULT_HW,               // Défaut matériel OCFA
+    FAULT_I2T,              // Surcharge prolongée
+    FAULT_CAUSE_NB
+} FAULT_CAUSE;
+
+#define FAULT_BIT(c)        ((uint8_t)(1u << (c)))
+
+typedef enum
+{
+    FAULT_RUN = 0,
+    FAULT_OFF,
+    FAULT_LATCHED
+} FAULT_STATE;
+
+// Politique d'une cause
+typedef struct
+{
+    uint16_t offTicks;      // Temps d'extinction minimal (ticks)
+    uint8_t  retries;       // Reprises avant verrouillage
+} FAULT_POLICY;
+
+// policy[FAULT_CAUSE_NB] doit rester valide (table constante)
+void        FAULT_Init(const FAULT_POLICY *policy, uint32_t goodTicks,
+                       int32_t i2tNom, int32_t i2tLimit);
+
+// Coupure déjà effectuée par l'appelant : causes = masque FAULT_BIT()
+void        FAULT_Trip(uint8_t causes);
+
+// Tick de supervision ; safe : conditions de reprise de l'application
+// réunies. Vrai quand une reprise peut être tentée.
+bool        FAULT_Tick(bool safe);
+
+// Reprise effectuée (étage relancé)
+void        FAULT_Restarted(void);
+
+// Accumulation I²t (code ADC du courant), vrai au-delà de la limite
+bool        FAULT_I2tUpdate(uint16_t iCode);
+
+// Réarmement manuel : verrouillage levé, budgets rendus (l'étage
+// reste coupé jusqu'au tick suivant)
+void        FAULT_Reset(void);
+
+FAULT_STATE FAULT_StateGet(void);
+uint8_t     FAULT_CauseGet(void);       // Causes de la coupure en cours
+uint8_t     FAULT_LatchedGet(void);     // Causes verrouillées
+uint8_t     FAULT_I2tPercent(void);     // Remplissage de l'accumulateur
+
+#endif
@@ -0,0 +1,107 @@
+//--------------------------------------------------------
+//      fixmath.h
+//--------------------------------------------------------
+//	Description :	Arithmétique virgule fixe Q15 / Q31 saturée
+//                  Le PIC32MX130F064B n'a pas de FPU : chaque opération
+//                  float dans l'ISR est un appel soft-float de libgcc.
+//                  Ces fonctions n'utilisent que MULT (32x32->64) et
+//                  des décalages.
+//
+//  Conventions :
+//      q15_t  : valeur dans [-1, 1[  avec 15 bits de fraction
+//      q31_t  : valeur dans [-1, 1[  avec 31 bits de fraction
+//      Q15(x), Q31(x) : conversion de constantes, évaluées à la
+//                       compilation (pas de float à l'exécution)
+//--------------------------------------------------------
+
+#ifndef FIXMATH_H
+#define FIXMATH_H
+
+#include <stdint.h>
+
+typedef int16_t q15_t;
+typedef int32_t q31_t;
+
+#define Q15_MAX     ((q15_t)0x7FFF)
+#define Q15_MIN     ((q15_t)0x8000)
+#define Q31_MAX     ((q31_t)0x7FFFFFFF)
+#define Q31_MIN     ((q31_t)0x80000000)
+
+// Conversion de constantes réelles (saturées à [-1, 1[)
+#define Q15(x)  ((q15_t)(((x) >= 1.0) ? 32767.0 : \
+                         (((x) <= -1.0) ? -32768.0 : \
+                          ((x) * 32768.0 + (((x) >= 0.0) ? 0.5 : -0.5)))))
+#define Q31(x)  ((q31_t)(((x) >= 1.0) ? 2147483647.0 : \
+                         (((x) <= -1.0) ? -2147483648.0 : \
+                          ((x) * 2147483648.0 + (((x) >= 0.0) ? 0.5 : -0.5)))))
+
+// Saturation d'un résultat 64 bits en Q31
+static inline q31_t Q31_Sat(int64_t x)
+{
+    if (x > (int64_t)Q31_MAX) return Q31_MAX;
+    if (x < (int64_t)Q31_MIN) return Q31_MIN;
+    return (q31_t)x;
+}
+
+// Saturation d'un résultat 32 bits en Q15
+static inline q15_t Q15_Sat(int32_t x)
+{
+    if (x > (int32_t)Q15_MAX) return Q15_MAX;
+    if (x < (int32_t)Q15_MIN) return Q15_MIN;
+    return (q15_t)x;
+}
+
+// a + b saturé
+static inline q31_t Q31_Add(q31_t a, q31_t b)
+{
+    return Q31_Sat((int64_t)a + b);
+}
+
+// a - b saturé
+static inline q31_t Q31_Sub(q31_t a, q31_t b)
+{
+    return Q31_Sat((int64_t)a - b);
+}
+
+// a * b (Q31 x Q31 -> Q31) saturé
+static inline q31_t Q31_Mul(q31_t a, q31_t b)
+{
+    return Q31_Sat(((int64_t)a * b) >> 31);
+}
+
+// coef * n (Q31 x entier -> Q31) saturé
+// Utilisé pour appliquer un gain exprimé par LSB ADC à une erreur en codes
+static inline q31_t Q31_MulInt(q31_t coef, int32_t n)
+{
+    return Q31_Sat((int64_t)coef * n);
+}
+
+// Limitation dans [lo, hi]
+static inline q31_t Q31_Limit(q31_t x, q31_t lo, q31_t hi)
+{
+    if (x > hi) return hi;
+    if (x < lo) return lo;
+    return x;
+}
+
+// Q31 -> Q15 (troncature)
+static inline q15_t Q31_ToQ15(q31_t x)
+{
+    return (q15_t)(x >> 16);
+}
+
+// Q15 -> Q31
+static inline q31_t Q15_ToQ31(q15_t x)
+{
+    return (q31_t)x << 16;
+}
+
+// Mise à l'échelle d'une valeur Q31 positive sur [0, full]
+// (ex. rapport cyclique -> valeur de compare OC)
+static inline uint32_t Q31_Scale(q31_t x, uint32_t full)
+{
+    if (x <= 0) return 0;
+    return (uint32_t)(((int64_t)x * full) >> 31);
+}
+
+#endif
@@ -0,0 +1,361 @@
+//--------------------------------------------------------
+//      i2cbus.c
+//--------------------------------------------------------
+//	Description :	Ordonnanceur du bus I2C1 (voir i2cbus.h)
+//--------------------------------------------------------
+
+#include "i2cbus.h"
+#include "Mc32_I2cUtilCCS.h"
+#include "system_definitions.h"
+
+// Transaction en attente ou confiée au driver
+typedef struct I2CBUS_SLOT
+{
+    struct I2CBUS_SLOT *next;       // File du client
+    DRV_I2C_BUFFER_HANDLE handle;
+    I2CBUS_CALLBACK cb;
+    uintptr_t context;
+    uint8_t  *tx;
+    uint8_t  *rx;
+    uint8_t  txLen;
+    uint8_t  rxLen;
+    uint8_t  address;
+    int8_t   client;
+    uint32_t submitMs;
+    uint16_t busyMs;                // Temps depuis la remise au driver
+    bool     used;
+    bool     inflight;
+    bool     deferred;              // Déjà comptée dans throttled
+} I2CBUS_SLOT;
+
+typedef struct
+{
+    I2CBUS_SLOT *head;
+    I2CBUS_SLOT *tail;
+    I2CBUS_PRIO prio;
+    uint16_t minGapMs;
+    uint16_t gapLeft;           // Limitation en cours (ms)
+    uint16_t periodMs;
+    uint16_t periodLeft;
+    I2CBUS_POLL poll;
+    uintptr_t pollContext;
+    I2CBUS_STATS stats;
+} I2CBUS_CLIENT;
+
+#define I2CBUS_SLOTS    (I2CBUS_CLIENTS * I2CBUS_CLIENT_SLOTS)
+
+static I2CBUS_SLOT   busSlot[I2CBUS_SLOTS];
+static I2CBUS_CLIENT busClient[I2CBUS_CLIENTS];
+static uint8_t  clientCount;
+static uint8_t  inflight;
+static uint8_t  rrNext;             // Tour de rôle à priorité égale
+static uint32_t busMs;              // Temps de I2CBUS_Tick
+static bool     recovering;         // Bus en récupération, driver arrêté
+
+static void _Pump(void);
+
+// Fin d'une transaction confiée au driver
+static void _Complete(I2CBUS_SLOT *slot, bool ok)
+{
+    I2CBUS_STATS *stats = &busClient[slot->client].stats;
+
+    stats->transfers++;
+    if (!ok)
+        stats->errors++;
+
+    slot->inflight = false;
+    slot->used = false;         // Libérée avant le rappel : il peut soumettre
+    inflight--;
+    if (slot->cb != NULL)
+        slot->cb(ok, slot->context);
+}
+
+// Fin de transaction (ISR I2C1) : retrouver la transaction par son handle
+static void _BufferEvent(DRV_I2C_BUFFER_EVENT event,
+                         DRV_I2C_BUFFER_HANDLE handle, uintptr_t context)
+{
+    uint8_t i;
+
+    (void)context;
+    if (event != DRV_I2C_BUFFER_EVENT_COMPLETE && event != DRV_I2C_BUFFER_EVENT_ERROR)
+        return;
+
+    for (i = 0; i < I2CBUS_SLOTS; i++)
+    {
+        if (!busSlot[i].inflight || busSlot[i].handle != handle)
+            continue;
+        _Complete(&busSlot[i], event == DRV_I2C_BUFFER_EVENT_COMPLETE);
+        _Pump();
+        return;
+    }
+}
+
+//------------------------------------------------------------------------------
+// _Timeout
+//
+// Transaction confiée au driver depuis plus de I2CBUS_TIMEOUT_MS (esclave
+// qui retient SDA ou étire SCL) : le driver statique n'a pas de timeout,
+// il est arrêté au milieu de la séquence et son interruption masquée ;
+// la transaction se termine en erreur et le bus est récupéré. Le driver
+// est réinitialisé (file vidée) à la fin de la récupération.
+//------------------------------------------------------------------------------
+
+static void _Timeout(I2CBUS_SLOT *slot)
+{
+    DRV_I2C0_DeInitialize();
+    PLIB_INT_SourceDisable(INT_ID_0, INT_SOURCE_I2C_1_MASTER);
+    PLIB_INT_SourceFlagClear(INT_ID_0, INT_SOURCE_I2C_1_MASTER);
+    i2c_recoverStart();
+    recovering = true;          // Avant le rappel : rien n'est remis au driver
+
+    busClient[slot->client].stats.timeouts++;
+    _Complete(slot, false);
+}
+
+// Client à servir : priorité la plus haute, hors limitation, tour de
+// rôle à partir de rrNext ; -1 si aucun
+static int8_t _Elect(void)
+{
+    int8_t best = -1;
+    uint8_t k, i;
+
+    for (k = 0; k < clientCount; k++)
+    {
+        I2CBUS_CLIENT *c;
+
+        i = (uint8_t)((rrNext + k) % clientCount);
+        c = &busClient[i];
+        if (c->head == NULL)
+            continue;
+        if (c->gapLeft != 0)
+        {
+            // Bus libre mais client limité : comptée une fois par transaction
+            if (!c->head->deferred)
+            {
+                c->head->deferred = true;
+                c->stats.throttled++;
+            }
+            continue;
+        }
+        if (best < 0 || c->prio < busClient[best].prio)
+            best = (int8_t)i;
+    }
+    return best;
+}
+
+// Confie au driver la transaction élue tant qu'il reste de la place
+static void _Pump(void)
+{
+    while (inflight < I2CBUS_INFLIGHT && !recovering)
+    {
+        int8_t id = _Elect();
+        I2CBUS_CLIENT *c;
+        I2CBUS_SLOT *slot;
+        DRV_I2C_BUFFER_HANDLE handle;
+        uint32_t wait;
+
+        if (id < 0)
+            return;
+        c = &busClient[id];
+        slot = c->head;
+
+        if (slot->rxLen == 0)
+            handle = DRV_I2C0_Transmit(slot->address, slot->tx, slot->txLen, NULL);
+        else if (slot->txLen == 0)
+            handle = DRV_I2C0_Receive(slot->address, slot->rx, slot->rxLen, NULL);
+        else
+            handle = DRV_I2C0_TransmitThenReceive(slot->address, slot->tx, slot->txLen,
+                                                  slot->rx, slot->rxLen, NULL);
+        if (handle == (DRV_I2C_BUFFER_HANDLE)NULL || handle == DRV_I2C_BUFFER_HANDLE_INVALID)
+            return;             // File du driver pleine : relance au tick
+
+        c->head = slot->next;
+        if (c->head == NULL)
+            c->tail = NULL;
+        slot->next = NULL;
+        slot->handle = handle;
+        slot->busyMs = 0;
+        slot->inflight = true;
+        inflight++;
+
+        c->gapLeft = c->minGapMs;
+        wait = busMs - slot->submitMs;
+        if (wait > c->stats.maxWaitMs)
+            c->stats.maxWaitMs = (uint16_t)(wait > 0xFFFFu ? 0xFFFFu : wait);
+        rrNext = (uint8_t)((id + 1) % clientCount);
+    }
+}
+
+static bool _Submit(int8_t client, uint8_t address,
+                    uint8_t *tx, uint8_t txLen, uint8_t *rx, uint8_t rxLen,
+                    I2CBUS_CALLBACK cb, uintptr_t context)
+{
+    I2CBUS_CLIENT *c;
+    I2CBUS_SLOT *slot = NULL;
+    uint8_t i;
+
+    if (client < 0 || client >= (int8_t)clientCount)
+        return false;
+    // Réserve du client : ses I2CBUS_CLIENT_SLOTS places dans la table
+    for (i = (uint8_t)(client * I2CBUS_CLIENT_SLOTS);
+         i < (client + 1) * I2CBUS_CLIENT_SLOTS; i++)
+    {
+        if (!busSlot[i].used)
+        {
+            slot = &busSlot[i];
+            break;
+        }
+    }
+    if (slot == NULL)
+        return false;
+
+    slot->used = true;
+    slot->inflight = false;
+    slot->deferred = false;
+    slot->next = NULL;
+    slot->client = client;
+    slot->address = address;
+    slot->tx = tx;
+    slot->txLen = txLen;
+    slot->rx = rx;
+    slot->rxLen = rxLen;
+    slot->cb = cb;
+    slot->context = context;
+    slot->submitMs = busMs;
+
+    c = &busClient[client];
+    if (c->tail == NULL)
+        c->head = slot;
+    else
+        c->tail->next = slot;
+    c->tail = slot;
+
+    _Pump();
+    return true;
+}
+
+void I2CBUS_Initialize(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < I2CBUS_SLOTS; i++)
+    {
+        busSlot[i].used = false;
+        busSlot[i].inflight = false;
+    }
+    clientCount = 0;
+    inflight = 0;
+    rrNext = 0;
+    busMs = 0;
+    recovering = false;
+    DRV_I2C0_BufferEventHandlerSet(_BufferEvent, 0);
+}
+
+int8_t I2CBUS_ClientAdd(I2CBUS_PRIO prio, uint16_t minGapMs)
+{
+    I2CBUS_CLIENT *c;
+
+    if (clientCount >= I2CBUS_CLIENTS)
+        return -1;
+    c = &busClient[clientCount];
+    c->head = NULL;
+    c->tail = NULL;
+    c->prio = prio;
+    c->minGapMs = minGapMs;
+    c->gapLeft = 0;
+    c->periodMs = 0;
+    c->poll = NULL;
+    c->stats.transfers = 0;
+    c->stats.errors = 0;
+    c->stats.throttled = 0;
+    c->stats.timeouts = 0;
+    c->stats.maxWaitMs = 0;
+    return (int8_t)clientCount++;
+}
+
+bool I2CBUS_Periodic(int8_t client, uint16_t periodMs,
+                     I2CBUS_POLL poll, uintptr_t context)
+{
+    I2CBUS_CLIENT *c;
+
+    if (client < 0 || client >= (int8_t)clientCount || periodMs == 0)
+        return false;
+    c = &busClient[client];
+    c->poll = poll;
+    c->pollContext = context;
+    c->periodMs = periodMs;
+    c->periodLeft = periodMs;
+    return true;
+}
+
+bool I2CBUS_Read(int8_t client, uint8_t address,
+                 uint8_t *tx, uint8_t txLen, uint8_t *rx, uint8_t rxLen,
+                 I2CBUS_CALLBACK cb, uintptr_t context)
+{
+    if (rxLen == 0)
+        return false;
+    return _Submit(client, address, tx, txLen, rx, rxLen, cb, context);
+}
+
+bool I2CBUS_Write(int8_t client, uint8_t address,
+                  uint8_t *tx, uint8_t txLen,
+                  I2CBUS_CALLBACK cb, uintptr_t context)
+{
+    if (txLen == 0)
+        return false;
+    return _Submit(client, address, tx, txLen, NULL, 0, cb, context);
+}
+
+void I2CBUS_Tick(uint16_t ms)
+{
+    uint8_t i;
+
+    busMs += ms;
+    if (recovering)
+    {
+        if (i2c_recoverStep())
+        {
+            DRV_I2C0_Initialize();
+            recovering = false;
+        }
+    }
+    else
+    {
+        for (i = 0; i < I2CBUS_SLOTS; i++)
+        {
+            I2CBUS_SLOT *slot = &busSlot[i];
+
+            if (!slot->inflight)
+                continue;
+            slot->busyMs = (slot->busyMs > 0xFFFFu - ms) ? 0xFFFFu : (uint16_t)(slot->busyMs + ms);
+            if (slot->busyMs >= I2CBUS_TIMEOUT_MS)
+            {
+                _Timeout(slot);
+                break;          // Driver arrêté : plus rien en cours
+            }
+        }
+    }
+
+    for (i = 0; i < clientCount; i++)
+    {
+        I2CBUS_CLIENT *c = &busClient[i];
+
+        c->gapLeft = (c->gapLeft > ms) ? (uint16_t)(c->gapLeft - ms) : 0;
+        if (c->poll == NULL)
+            continue;
+        if (c->periodLeft > ms)
+            c->periodLeft -= ms;
+        else
+        {
+            c->periodLeft = c->periodMs;
+            c->poll(c->pollContext);
+        }
+    }
+    _Pump();
+}
+
+void I2CBUS_StatsGet(int8_t client, I2CBUS_STATS *stats)
+{
+    if (client >= 0 && client < (int8_t)clientCount)
+        *stats = busClient[client].stats;
+}
@@ -0,0 +1,101 @@
+//--------------------------------------------------------
+//      i2cbus.h
+//--------------------------------------------------------
+//	Description :	Ordonnanceur des transactions du bus I2C1
+//                  Seul client du driver I2C statique (DRV_I2C0).
+//
+//  Chaque pilote d'esclave (INA226, LM92...) s'enregistre comme client
+//  avec une priorité et un intervalle minimal entre deux de ses
+//  transactions (limitation de débit). Les transactions ponctuelles
+//  (I2CBUS_Read, I2CBUS_Write) et les relevés périodiques (rappel
+//  I2CBUS_Periodic qui soumet ses lectures) attendent dans la file de
+//  leur client ; la file du driver (QueueIn_0/QueueOut_0) ne reçoit
+//  qu'I2CBUS_INFLIGHT transaction à la fois. L'ordre du bus est donc
+//  décidé ici, au moment où le bus se libère : une lecture prioritaire
+//  soumise derrière des lectures lentes n'attend au plus que la
+//  transaction en cours, jamais une file FIFO déjà remplie.
+//
+//  Chaque client dispose de sa propre réserve de I2CBUS_CLIENT_SLOTS
+//  transactions : un client trop bavard voit ses soumissions refusées
+//  sans priver les autres de place.
+//
+//  Choix de la transaction suivante : client de plus haute priorité
+//  ayant une transaction en attente et hors limitation de débit ; à
+//  priorité égale, tour de rôle.
+//
+//  Le driver statique n'a pas de timeout : une transaction qui lui est
+//  confiée depuis plus de I2CBUS_TIMEOUT_MS (esclave qui retient SDA ou
+//  étire SCL) est abandonnée par I2CBUS_Tick et rendue en erreur. Le bus
+//  est alors libéré par i2c_recoverStart/i2c_recoverStep (9 impulsions
+//  SCL puis stop, un pas par tick, voir Mc32_I2cUtilCCS.h) et le driver
+//  réinitialisé ; rien ne lui est confié pendant la récupération.
+//
+//  Contexte d'appel : priorité 1 (supervision Timer1, ISR I2C1 et
+//  change notification), ou boucle principale avec les interruptions
+//  I2C1 maître et change notification masquées (initialisation). Les
+//  rappels sont appelés depuis l'ISR I2C1 ou depuis I2CBUS_Tick ; ils
+//  peuvent soumettre de nouvelles transactions. Les tampons tx/rx
+//  appartiennent à l'appelant jusqu'au rappel.
+//--------------------------------------------------------
+
+#ifndef I2CBUS_H
+#define I2CBUS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define I2CBUS_CLIENTS      4       // Pilotes d'esclaves
+#define I2CBUS_CLIENT_SLOTS 4       // Transactions en attente par client
+#define I2CBUS_INFLIGHT     1       // Transactions confiées au driver
+#define I2CBUS_TIMEOUT_MS   10      // Transaction du driver abandonnée au-delà
+
+typedef enum
+{
+    I2CBUS_PRIO_HIGH = 0,   // Mesures rapides (INA226)
+    I2CBUS_PRIO_NORMAL,
+    I2CBUS_PRIO_LOW         // Relevés lents (température...)
+} I2CBUS_PRIO;
+
+// Fin de transaction : ok faux si l'esclave n'a pas acquitté ou si le
+// bus est resté bloqué plus de I2CBUS_TIMEOUT_MS
+typedef void (*I2CBUS_CALLBACK)(bool ok, uintptr_t context);
+
+// Relevé périodique : soumet les transactions du client
+typedef void (*I2CBUS_POLL)(uintptr_t context);
+
+typedef struct
+{
+    uint32_t transfers;     // Transactions terminées
+    uint32_t errors;        // Non acquittées ou abandonnées
+    uint32_t throttled;     // Transactions retardées par la limitation
+    uint32_t timeouts;      // Abandonnées (bus bloqué), suivies d'une récupération
+    uint16_t maxWaitMs;     // Attente max entre soumission et bus
+} I2CBUS_STATS;
+
+// Installe le rappel du driver et vide les files
+void    I2CBUS_Initialize(void);
+
+// Nouveau client ; minGapMs = 0 : pas de limitation. -1 si table pleine.
+int8_t  I2CBUS_ClientAdd(I2CBUS_PRIO prio, uint16_t minGapMs);
+
+// poll(context) toutes les periodMs, depuis I2CBUS_Tick
+bool    I2CBUS_Periodic(int8_t client, uint16_t periodMs,
+                        I2CBUS_POLL poll, uintptr_t context);
+
+// Écriture de tx puis lecture de rxLen octets (restart) ; txLen = 0 :
+// lecture seule. Faux si plus de place (rien n'est lancé).
+bool    I2CBUS_Read(int8_t client, uint8_t address,
+                    uint8_t *tx, uint8_t txLen, uint8_t *rx, uint8_t rxLen,
+                    I2CBUS_CALLBACK cb, uintptr_t context);
+bool    I2CBUS_Write(int8_t client, uint8_t address,
+                     uint8_t *tx, uint8_t txLen,
+                     I2CBUS_CALLBACK cb, uintptr_t context);
+
+// Base de temps (supervision) : limitation de débit, relevés
+// périodiques, timeout de la transaction en cours et récupération du
+// bus, relance si la file du driver était pleine
+void    I2CBUS_Tick(uint16_t ms);
+
+void    I2CBUS_StatsGet(int8_t client, I2CBUS_STATS *stats);
+
+#endif
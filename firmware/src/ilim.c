@@ -0,0 +1,129 @@
+//--------------------------------------------------------
+//      ilim.c
+//--------------------------------------------------------
+//	Description :	Limitation de courant cycle par cycle
+//                  Voir ilim.h pour le câblage et les niveaux de CVREF.
+//--------------------------------------------------------
+
+#include "app.h"
+#include "ilim.h"
+#include "pwm.h"
+#include "peripheral/cmp/plib_cmp.h"
+
+#define ILIM_LEVELS     16
+
+static float    ilimVolts;          // Seuil effectif
+static bool     ilimStarted;
+static volatile bool ilimActive;
+static volatile uint32_t ilimCount;
+
+// Tension d'un niveau de CVREF
+static float _Level(bool wide, uint8_t n)
+{
+    return wide ? ILIM_CVRSRC * n / 24.0f
+                : ILIM_CVRSRC * (0.25f + n / 32.0f);
+}
+
+// Comparateur 1 : C1INB contre CVREF, sortie inversée (haute au-delà du
+// seuil), interruption sur le franchissement montant
+static void _Start(void)
+{
+    PLIB_CMP_CVREF_SourceVoltageSelect(CMP_ID_1, CMP_CVREF_VOLTAGE_SOURCE_VDD);
+    PLIB_CMP_CVREF_Enable(CMP_ID_1);
+
+    PLIB_CMP_NonInvertingInputSelect(CMP_ID_1, CMP_NON_INVERTING_INPUT_CDAC);
+    PLIB_CMP_InvertingInputSelect(CMP_ID_1, CMP_INVERTING_INPUT_1);
+    PLIB_CMP_OutputInvertEnable(CMP_ID_1);
+    PLIB_CMP_InterruptEventSelect(CMP_ID_1, CMP_INTERRUPT_GENERATION_LOW_TO_HIGH);
+    PLIB_CMP_Enable(CMP_ID_1);
+
+    PLIB_INT_VectorPrioritySet(INT_ID_0, INT_VECTOR_CMP1, INT_PRIORITY_LEVEL7);
+    PLIB_INT_VectorSubPrioritySet(INT_ID_0, INT_VECTOR_CMP1, INT_SUBPRIORITY_LEVEL0);
+    PLIB_INT_SourceFlagClear(INT_ID_0, INT_SOURCE_COMPARATOR_1);
+    PLIB_INT_SourceEnable(INT_ID_0, INT_SOURCE_COMPARATOR_1);
+}
+
+bool ILIM_Configure(float volts)
+{
+    float best = 0.0f;
+    bool bestWide = true;
+    uint8_t bestN = 0;
+    uint8_t n;
+
+    for (n = 0; n < ILIM_LEVELS; n++)
+    {
+        if (_Level(true, n) <= volts && _Level(true, n) > best)
+        {
+            best = _Level(true, n);
+            bestWide = true;
+            bestN = n;
+        }
+        if (_Level(false, n) <= volts && _Level(false, n) > best)
+        {
+            best = _Level(false, n);
+            bestWide = false;
+            bestN = n;
+        }
+    }
+    if (best <= 0.0f)
+        return false;
+
+    if (bestWide)
+        PLIB_CMP_CVREF_WideRangeEnable(CMP_ID_1);
+    else
+        PLIB_CMP_CVREF_WideRangeDisable(CMP_ID_1);
+    PLIB_CMP_CVREF_ValueSelect(CMP_ID_1, (CMP_CVREF_VALUE)(CMP_CVREF_VALUE_0 + bestN));
+    ilimVolts = best;
+
+    if (!ilimStarted)
+    {
+        _Start();
+        ilimStarted = true;
+    }
+    return true;
+}
+
+float ILIM_ThresholdGet(void)
+{
+    return ilimVolts;
+}
+
+uint32_t ILIM_CountGet(void)
+{
+    return ilimCount;
+}
+
+bool ILIM_IsActive(void)
+{
+    return ilimActive;
+}
+
+//------------------------------------------------------------------------------
+// ILIM_Trip
+//
+// Franchissement du seuil : impulsion tronquée, puis surveillance de
+// chaque début de période par Timer2 (drapeau levé à chaque période
+// même interruption dévalidée : effacé avant validation).
+//------------------------------------------------------------------------------
+
+void ILIM_Trip(void)
+{
+    PWM_PulseTerminate();
+    ilimCount++;
+    ilimActive = true;
+
+    PLIB_INT_SourceFlagClear(INT_ID_0, INT_SOURCE_TIMER_2);
+    PLIB_INT_SourceEnable(INT_ID_0, INT_SOURCE_TIMER_2);
+}
+
+void ILIM_PeriodStart(void)
+{
+    if (PLIB_CMP_OutputStatusGet(CMP_ID_1))
+    {
+        PWM_PulseTerminate(); // Toujours au-delà du seuil
+        ilimCount++;
+        return;
+    }
+    PLIB_INT_SourceDisable(INT_ID_0, INT_SOURCE_TIMER_2);
+    ilimActive = false;
+}
@@ -0,0 +1,50 @@
+//--------------------------------------------------------
+//      ilim.h
+//--------------------------------------------------------
+//	Description :	Limitation de courant cycle par cycle
+//                  (comparateur 1 et CVREF)
+//
+//  Câblage : la sortie de l'ampli de shunt (AN12) attaque aussi C1INB
+//  (RB2), entrée inverseuse du comparateur 1 ; l'entrée non inverseuse
+//  est CVREF. Sortie inversée : C1OUT haut quand le courant dépasse le
+//  seuil.
+//
+//  Fonctionnement :
+//      front montant de C1OUT -> ISR CMP1 (priorité 7) : l'impulsion en
+//      cours est tronquée (PWM_PulseTerminate), la période suivante
+//      repart normalement ;
+//      tant que C1OUT reste haut, l'ISR Timer2 (début de période,
+//      priorité 7) tronque aussi les impulsions suivantes dès leur
+//      début ; elle est dévalidée dès que le courant repasse sous le
+//      seuil (aucun coût hors limitation).
+//  La régulation n'est pas interrompue : une surcharge brève passe sans
+//  coupure ni reprise (voir CheckSafety / SafeRecovery).
+//
+//  CVREF : 16 niveaux, deux gammes (CVRR)
+//      CVRR = 1 : n/24 . CVRSRC            (0 .. 0.625 CVRSRC)
+//      CVRR = 0 : (1/4 + n/32) . CVRSRC    (0.25 .. 0.72 CVRSRC)
+//  ILIM_Configure retient le plus haut niveau <= seuil demandé.
+//--------------------------------------------------------
+
+#ifndef ILIM_H
+#define ILIM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ILIM_CVRSRC     3.3f        // Source de CVREF : AVDD (V)
+
+// Seuil sur C1INB (V), modifiable en fonctionnement ; le premier appel
+// valide le comparateur. Faux si le seuil est sous le premier niveau
+// non nul de CVREF (seuil inchangé).
+bool     ILIM_Configure(float volts);
+
+float    ILIM_ThresholdGet(void);   // Seuil effectif (V)
+uint32_t ILIM_CountGet(void);       // Impulsions tronquées
+bool     ILIM_IsActive(void);       // Limitation en cours
+
+// Appelées par les ISR CMP1 et Timer2
+void     ILIM_Trip(void);
+void     ILIM_PeriodStart(void);
+
+#endif
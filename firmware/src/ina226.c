@@ -0,0 +1,228 @@
+//--------------------------------------------------------
+//      ina226.c
+//--------------------------------------------------------
+//	Description :	Moniteur INA226, accès non bloquants
+//                  Voir ina226.h pour le contexte d'appel.
+//--------------------------------------------------------
+
+#include <stddef.h>
+#include "ina226.h"
+#include "i2cbus.h"
+
+#define INA226_SLOTS        4       // Accès en cours simultanés
+
+// Un accès en cours : tampons conservés jusqu'à la fin de transaction
+typedef struct
+{
+    INA226_CALLBACK cb;
+    uintptr_t context;
+    uint8_t  tx[3];                 // Pointeur de registre (+ valeur)
+    uint8_t  rx[2];
+    bool     read;
+    bool     busy;
+} INA226_SLOT;
+
+static INA226_SLOT inaSlot[INA226_SLOTS];
+static int8_t   inaClient = -1;     // Client de l'ordonnanceur I2C
+static volatile uint16_t inaBus;
+static volatile int16_t  inaShunt;
+static volatile uint32_t inaSamples;
+static volatile uint32_t inaErrors;
+static volatile uint32_t inaAlerts;
+static bool     inaReady;           // INA226_Initialize appelé
+static bool     alertPending;       // Front ALERT pendant une lecture
+static uint8_t  updateLeft;         // Lectures de INA226_Update en cours (bits)
+static uint8_t  updateOk;           // Lectures réussies (bits)
+
+#define UPDATE_MASK         0x01
+#define UPDATE_BUS          0x02
+#define UPDATE_SHUNT        0x04
+
+// Fin de transaction (ISR I2C1, via l'ordonnanceur)
+static void _Done(bool ok, uintptr_t context)
+{
+    INA226_SLOT *slot = (INA226_SLOT *)context;
+    uint16_t value = 0;
+
+    if (!ok)
+        inaErrors++;
+    else if (slot->read)
+        value = ((uint16_t)slot->rx[0] << 8) | slot->rx[1];
+
+    slot->busy = false; // Libéré avant le rappel : il peut relancer
+    if (slot->cb != NULL)
+        slot->cb(slot->tx[0], value, ok, slot->context);
+}
+
+static INA226_SLOT *_SlotGet(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < INA226_SLOTS; i++)
+    {
+        if (!inaSlot[i].busy)
+            return &inaSlot[i];
+    }
+    return NULL;
+}
+
+void INA226_Initialize(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < INA226_SLOTS; i++)
+        inaSlot[i].busy = false;
+    updateLeft = 0;
+    alertPending = false;
+    inaReady = true;
+
+    if (inaClient < 0)
+        inaClient = I2CBUS_ClientAdd(I2CBUS_PRIO_HIGH, 0);
+    INA226_WriteRegister(INA226_REG_CONFIG, INA226_CONFIG_RUN, NULL, 0);
+}
+
+bool INA226_ReadRegister(uint8_t reg, INA226_CALLBACK cb, uintptr_t context)
+{
+    INA226_SLOT *slot = _SlotGet();
+
+    if (slot == NULL)
+        return false;
+    slot->busy = true;
+    slot->read = true;
+    slot->cb = cb;
+    slot->context = context;
+    slot->tx[0] = reg;
+    if (!I2CBUS_Read(inaClient, INA226_ADDR, slot->tx, 1, slot->rx, 2,
+                     _Done, (uintptr_t)slot))
+    {
+        slot->busy = false;     // File de l'ordonnanceur pleine
+        return false;
+    }
+    return true;
+}
+
+bool INA226_WriteRegister(uint8_t reg, uint16_t value,
+                          INA226_CALLBACK cb, uintptr_t context)
+{
+    INA226_SLOT *slot = _SlotGet();
+
+    if (slot == NULL)
+        return false;
+    slot->busy = true;
+    slot->read = false;
+    slot->cb = cb;
+    slot->context = context;
+    slot->tx[0] = reg;
+    slot->tx[1] = (uint8_t)(value >> 8);
+    slot->tx[2] = (uint8_t)value;
+    if (!I2CBUS_Write(inaClient, INA226_ADDR, slot->tx, 3, _Done, (uintptr_t)slot))
+    {
+        slot->busy = false;
+        return false;
+    }
+    return true;
+}
+
+// Rappel des lectures : la paire bus/shunt est comptée quand les deux
+// registres sont revenus sans erreur. Un front ALERT arrivé pendant la
+// lecture la relance dès qu'elle est terminée.
+static void _UpdateDone(uint8_t reg, uint16_t value, bool ok, uintptr_t context)
+{
+    uint8_t bit = (uint8_t)context;
+
+    if (ok)
+    {
+        if (bit == UPDATE_MASK)
+        {
+            if (value & INA226_MASK_AFF)
+                inaAlerts++;
+        }
+        else if (bit == UPDATE_BUS)
+            inaBus = value;
+        else
+            inaShunt = (int16_t)value;
+        updateOk |= bit;
+    }
+    updateLeft &= (uint8_t)~bit;
+    if (updateLeft != 0)
+        return;
+    if ((updateOk & (UPDATE_BUS | UPDATE_SHUNT)) == (UPDATE_BUS | UPDATE_SHUNT))
+        inaSamples++;
+    if (alertPending)
+    {
+        alertPending = false;
+        INA226_Update();
+    }
+}
+
+// Les trois lectures sont mises en file ensemble : Mask/Enable passe
+// en premier et relâche ALERT avant la conversion suivante
+bool INA226_Update(void)
+{
+    static const uint8_t reg[3] = { INA226_REG_MASK, INA226_REG_BUS, INA226_REG_SHUNT };
+    uint8_t i, bit;
+
+    if (updateLeft != 0)
+        return false;
+
+    updateOk = 0;
+    updateLeft = UPDATE_MASK | UPDATE_BUS | UPDATE_SHUNT;
+    for (i = 0; i < 3; i++)
+    {
+        bit = (uint8_t)(1u << i);
+        if (!INA226_ReadRegister(reg[i], _UpdateDone, bit))
+        {
+            // Lectures restantes abandonnées : la paire n'est pas comptée
+            updateLeft &= (uint8_t)((1u << i) - 1u);
+            return false;
+        }
+    }
+    return true;
+}
+
+void INA226_AlertEvent(void)
+{
+    if (!inaReady)
+        return;     // ALERT avant la configuration : relance par l'appli
+    if (updateLeft != 0)
+        alertPending = true;
+    else
+        INA226_Update();
+}
+
+bool INA226_AlertConfigure(uint16_t function, uint16_t limit)
+{
+    if (!INA226_WriteRegister(INA226_REG_ALERT, limit, NULL, 0))
+        return false;
+    return INA226_WriteRegister(INA226_REG_MASK, function | INA226_MASK_CNVR, NULL, 0);
+}
+
+float INA226_GetBusVoltage(void)
+{
+    return inaBus * INA226_BUS_LSB;
+}
+
+float INA226_GetShuntVoltage(void)
+{
+    return inaShunt * INA226_SHUNT_LSB;
+}
+
+float INA226_GetCurrent(float Rshunt)
+{
+    return INA226_GetShuntVoltage() / Rshunt;
+}
+
+uint32_t INA226_SampleCount(void)
+{
+    return inaSamples;
+}
+
+uint32_t INA226_AlertCount(void)
+{
+    return inaAlerts;
+}
+
+uint32_t INA226_ErrorCount(void)
+{
+    return inaErrors;
+}
@@ -0,0 +1,110 @@
+//--------------------------------------------------------
+//      ina226.h
+//--------------------------------------------------------
+//	Description :	Moniteur de courant/tension INA226 (I2C1)
+//                  Accès non bloquants par l'ordonnanceur du bus
+//                  (i2cbus.h), client de priorité haute.
+//
+//  Chaque accès est mis en file (I2CBUS_Read, I2CBUS_Write) et le
+//  résultat est rendu par une fonction de rappel, appelée depuis l'ISR
+//  I2C1 (priorité 1) à la fin de la transaction : aucune attente active,
+//  ni dans la super-boucle ni dans les ISR de régulation.
+//  Les rappels doivent rester courts (recopie, pas de nouvel accès
+//  bloquant) ; ils peuvent relancer une lecture.
+//
+//  Les fonctions de ce module sont appelées depuis le contexte de
+//  priorité 1 (supervision Timer1, ISR change notification) : même
+//  priorité que l'ISR I2C1, pas de préemption mutuelle sur la table des
+//  accès en cours. Depuis la boucle principale (initialisation), les
+//  interruptions I2C1 maître et change notification doivent être
+//  masquées pendant l'appel (voir APP_MonitorStart).
+//
+//  La sortie ALERT (collecteur ouvert, active basse, RB7 avec pull-up)
+//  signale la fin de chaque conversion (CNVR) et la fonction d'alerte
+//  choisie (dépassement de limite). Son front descendant lance la
+//  lecture : Mask/Enable d'abord (relâche ALERT, indique CVRF/AFF),
+//  puis bus et shunt, sans interrogation périodique du bus I2C.
+//
+//  Registres 16 bits, octet de poids fort en premier.
+//      Bus    : 1.25 mV / LSB
+//      Shunt  : 2.5 uV / LSB, signé (+-81.92 mV)
+//--------------------------------------------------------
+
+#ifndef INA226_H
+#define INA226_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define INA226_ADDR         0x80    // A1 = A0 = GND (adresse 8 bits)
+
+// Registres
+#define INA226_REG_CONFIG   0x00
+#define INA226_REG_SHUNT    0x01
+#define INA226_REG_BUS      0x02
+#define INA226_REG_POWER    0x03
+#define INA226_REG_CURRENT  0x04
+#define INA226_REG_CALIB    0x05
+#define INA226_REG_MASK     0x06
+#define INA226_REG_ALERT    0x07
+#define INA226_REG_MANUF    0xFE    // 0x5449 ("TI")
+#define INA226_REG_DIE      0xFF
+
+// Configuration : moyenne sur 4, 1.1 ms par conversion (bus et shunt),
+// conversion continue -> une mesure complète toutes les 8.8 ms
+#define INA226_CONFIG_RUN   0x4327
+
+// Registre Mask/Enable
+#define INA226_MASK_SOL     0x8000  // Shunt au-dessus de la limite
+#define INA226_MASK_SUL     0x4000  // Shunt en dessous de la limite
+#define INA226_MASK_BOL     0x2000  // Bus au-dessus de la limite
+#define INA226_MASK_BUL     0x1000  // Bus en dessous de la limite
+#define INA226_MASK_POL     0x0800  // Puissance au-dessus de la limite
+#define INA226_MASK_CNVR    0x0400  // ALERT en fin de conversion
+#define INA226_MASK_AFF     0x0010  // Fonction d'alerte déclenchée
+#define INA226_MASK_CVRF    0x0008  // Conversion terminée
+#define INA226_MASK_OVF     0x0004  // Débordement du calcul
+#define INA226_MASK_APOL    0x0002  // ALERT active haute
+#define INA226_MASK_LEN     0x0001  // ALERT verrouillée
+
+#define INA226_BUS_LSB      0.00125f    // V
+#define INA226_SHUNT_LSB    0.0000025f  // V
+
+// Fin d'accès : ok faux si l'INA226 n'a pas acquitté (valeur à zéro)
+typedef void (*INA226_CALLBACK)(uint8_t reg, uint16_t value, bool ok,
+                                uintptr_t context);
+
+// S'enregistre auprès de l'ordonnanceur (I2CBUS_Initialize déjà
+// appelé) et écrit la configuration
+void     INA226_Initialize(void);
+
+// Accès asynchrones : faux si la file est pleine (rien n'est lancé).
+// cb peut être NULL (écriture sans compte rendu).
+bool     INA226_ReadRegister(uint8_t reg, INA226_CALLBACK cb, uintptr_t context);
+bool     INA226_WriteRegister(uint8_t reg, uint16_t value,
+                              INA226_CALLBACK cb, uintptr_t context);
+
+// ALERT en fin de conversion et sur la fonction donnée (INA226_MASK_SOL,
+// ..., ou 0), limite dans l'unité du registre comparé ; faux si la
+// file est pleine
+bool     INA226_AlertConfigure(uint16_t function, uint16_t limit);
+
+// Front descendant de ALERT (ISR change notification) : lance la
+// lecture, ou la reporte à la fin de la lecture en cours
+void     INA226_AlertEvent(void);
+
+// Lance la lecture des registres Mask/Enable, bus et shunt ; faux si
+// la lecture précédente n'est pas terminée. Les valeurs sont mises à
+// jour dans le rappel et lues sans attente par les fonctions suivantes.
+// Appelée par INA226_AlertEvent, ou directement (relance si ALERT
+// reste muette).
+bool     INA226_Update(void);
+
+float    INA226_GetBusVoltage(void);        // V
+float    INA226_GetShuntVoltage(void);      // V
+float    INA226_GetCurrent(float Rshunt);   // A
+uint32_t INA226_SampleCount(void);          // Paires bus/shunt lues
+uint32_t INA226_AlertCount(void);           // Fonction d'alerte (AFF) vue
+uint32_t INA226_ErrorCount(void);           // Accès non acquittés
+
+#endif
@@ -0,0 +1,72 @@
+//--------------------------------------------------------
+//      lm92.c
+//--------------------------------------------------------
+//	Description :	Capteur LM92, relevé non bloquant
+//                  Voir lm92.h pour le contexte d'appel.
+//--------------------------------------------------------
+
+#include "lm92.h"
+#include "i2cbus.h"
+
+#define LM92_GAP_MS         10      // Limitation de débit du client
+
+static int8_t   lmClient = -1;
+static uint8_t  lmTx[1] = { LM92_REG_TEMP };
+static uint8_t  lmRx[2];
+static bool     lmBusy;             // Lecture en cours
+static volatile uint16_t lmRaw;
+static volatile uint32_t lmSamples;
+static volatile uint32_t lmErrors;
+
+static void _ReadDone(bool ok, uintptr_t context)
+{
+    (void)context;
+    lmBusy = false;
+    if (!ok)
+    {
+        lmErrors++;
+        return;
+    }
+    lmRaw = ((uint16_t)lmRx[0] << 8) | lmRx[1];
+    lmSamples++;
+}
+
+// Relevé périodique (I2CBUS_Tick) : une seule lecture en cours
+static void _Poll(uintptr_t context)
+{
+    (void)context;
+    if (lmBusy)
+        return;
+    lmBusy = I2CBUS_Read(lmClient, LM92_ADDR, lmTx, 1, lmRx, 2, _ReadDone, 0);
+}
+
+bool LM92_Initialize(uint16_t periodMs)
+{
+    lmBusy = false;
+    if (lmClient < 0)
+        lmClient = I2CBUS_ClientAdd(I2CBUS_PRIO_LOW, LM92_GAP_MS);
+    if (!I2CBUS_Periodic(lmClient, periodMs, _Poll, 0))
+        return false;
+    _Poll(0);
+    return true;
+}
+
+int16_t LM92_Temperature16(void)
+{
+    return (int16_t)lmRaw >> 3;     // Décalage arithmétique : signe conservé
+}
+
+uint8_t LM92_Status(void)
+{
+    return (uint8_t)(lmRaw & 0x07);
+}
+
+uint32_t LM92_SampleCount(void)
+{
+    return lmSamples;
+}
+
+uint32_t LM92_ErrorCount(void)
+{
+    return lmErrors;
+}
@@ -0,0 +1,48 @@
+//--------------------------------------------------------
+//      lm92.h
+//--------------------------------------------------------
+//	Description :	Capteur de température LM92 (I2C1)
+//                  Relevé périodique par l'ordonnanceur du bus
+//                  (i2cbus.h), client de priorité basse.
+//
+//  Le LM92 convertit en continu (une mesure toutes les ~500 ms) ; le
+//  registre de température est lu tous les periodMs, sans attente : le
+//  résultat arrive dans le rappel de l'ISR I2C1 et est lu par les
+//  fonctions ci-dessous. Même contexte d'appel que ina226.h.
+//
+//  Registre de température, 16 bits, octet de poids fort en premier :
+//      D15..D3 : température signée, 0.0625 °C / LSB
+//      D2..D0  : T_CRIT, T_HIGH, T_LOW
+//--------------------------------------------------------
+
+#ifndef LM92_H
+#define LM92_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define LM92_ADDR           0x90    // A1 = A0 = GND (adresse 8 bits)
+
+// Registres
+#define LM92_REG_TEMP       0x00
+#define LM92_REG_CONFIG     0x01
+#define LM92_REG_HYST       0x02
+#define LM92_REG_CRIT       0x03
+#define LM92_REG_LOW        0x04
+#define LM92_REG_HIGH       0x05
+#define LM92_REG_ID         0x07    // 0x8001
+
+#define LM92_STATUS_CRIT    0x04
+#define LM92_STATUS_HIGH    0x02
+#define LM92_STATUS_LOW     0x01
+
+// S'enregistre auprès de l'ordonnanceur (I2CBUS_Initialize déjà appelé)
+// et lance la première lecture ; faux si l'ordonnanceur est plein
+bool     LM92_Initialize(uint16_t periodMs);
+
+int16_t  LM92_Temperature16(void);  // Dernière mesure (1/16 °C)
+uint8_t  LM92_Status(void);         // LM92_STATUS_xxx de cette mesure
+uint32_t LM92_SampleCount(void);    // Lectures réussies
+uint32_t LM92_ErrorCount(void);     // Lectures non acquittées
+
+#endif
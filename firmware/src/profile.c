@@ -0,0 +1,136 @@
+//--------------------------------------------------------
+//      profile.c
+//--------------------------------------------------------
+//	Description :	Mesure des durées d'exécution par zone nommée
+//                  (voir profile.h)
+//--------------------------------------------------------
+
+#include "profile.h"
+
+#if PROFILE_ENABLE
+
+#include <stdio.h>
+#include <string.h>
+#include "system/int/sys_int.h"
+
+#define PROFILE_LINE        128
+
+PROFILE_STATS profileZone[PROFILE_ZONES];
+
+static const char *const profileName[PROFILE_ZONES] =
+{
+    "superv", "pwm", "regul", "i2c", "app_tasks"
+};
+
+//------------------------------------------------------------------------------
+// PROFILE_Record
+//
+// Appelée par PROFILE_END, dans le contexte de la zone. Case de
+// l'histogramme : position du bit de poids fort (instruction clz).
+//------------------------------------------------------------------------------
+
+void PROFILE_Record(PROFILE_ZONE zone, uint32_t ticks)
+{
+    PROFILE_STATS *z = &profileZone[zone];
+    int bin = 0;
+
+    if (ticks >= (1u << PROFILE_BIN_FIRST))
+    {
+        bin = 31 - __builtin_clz(ticks) - (PROFILE_BIN_FIRST - 1);
+        if (bin > PROFILE_BINS - 1)
+            bin = PROFILE_BINS - 1;
+    }
+    if (z->count == 0 || ticks < z->min)
+        z->min = ticks;
+    if (ticks > z->max)
+        z->max = ticks;
+    z->sum += ticks;
+    z->count++;
+    z->hist[bin]++;
+}
+
+void PROFILE_BudgetSet(PROFILE_ZONE zone, uint32_t ticks)
+{
+    profileZone[zone].budget = ticks;
+}
+
+// Compteurs remis à zéro, budgets conservés
+void PROFILE_Reset(void)
+{
+    bool enabled = SYS_INT_Disable();
+    int i;
+
+    for (i = 0; i < PROFILE_ZONES; i++)
+    {
+        PROFILE_STATS *z = &profileZone[i];
+        z->count = 0;
+        z->min = 0;
+        z->max = 0;
+        z->sum = 0;
+        memset(z->hist, 0, sizeof(z->hist));
+    }
+    SYS_INT_Restore(enabled);
+}
+
+void PROFILE_Get(PROFILE_ZONE zone, PROFILE_STATS *stats)
+{
+    bool enabled = SYS_INT_Disable();
+
+    *stats = profileZone[zone];
+    SYS_INT_Restore(enabled);
+}
+
+//------------------------------------------------------------------------------
+// PROFILE_Dump
+//
+// Par zone : une ligne de synthèse (cycles SYSCLK et µs), puis les cases
+// non vides de l'histogramme. Hors ISR (snprintf).
+//------------------------------------------------------------------------------
+
+void PROFILE_Dump(void (*line)(const char *text))
+{
+    char text[PROFILE_LINE];
+    int i, b;
+
+    snprintf(text, sizeof(text), "profile: %lu Hz core timer, cycles = 2 ticks",
+             (unsigned long)PROFILE_TICK_HZ);
+    line(text);
+
+    for (i = 0; i < PROFILE_ZONES; i++)
+    {
+        PROFILE_STATS z;
+        int n;
+
+        PROFILE_Get((PROFILE_ZONE)i, &z);
+        if (z.count == 0)
+            continue;
+
+        n = snprintf(text, sizeof(text),
+                     "%-9s n=%lu  cycles min %lu mean %lu max %lu (%.2f us)",
+                     profileName[i], (unsigned long)z.count,
+                     (unsigned long)z.min * 2, (unsigned long)(z.sum / z.count) * 2,
+                     (unsigned long)z.max * 2, z.max * 1e6f / PROFILE_TICK_HZ);
+        if (z.budget != 0 && n > 0 && n < (int)sizeof(text))
+            snprintf(text + n, sizeof(text) - n, ", %lu %% of budget",
+                     (unsigned long)((uint64_t)z.max * 100u / z.budget));
+        line(text);
+
+        n = snprintf(text, sizeof(text), "          ");
+        for (b = 0; b < PROFILE_BINS && n > 0 && n < (int)sizeof(text); b++)
+        {
+            unsigned long lo = 2ul << (b + PROFILE_BIN_FIRST - 1);   // Cycles
+
+            if (z.hist[b] == 0)
+                continue;
+            if (b == PROFILE_BINS - 1)
+                n += snprintf(text + n, sizeof(text) - n, " >=%lu:%lu", lo,
+                              (unsigned long)z.hist[b]);
+            else
+                n += snprintf(text + n, sizeof(text) - n, " <%lu:%lu", lo * 2,
+                              (unsigned long)z.hist[b]);
+        }
+        line(text);
+    }
+}
+
+#endif
@@ -0,0 +1,88 @@
+//--------------------------------------------------------
+//      profile.h
+//--------------------------------------------------------
+//	Description :	Mesure des durées d'exécution par zone nommée
+//                  Compteur du coeur (registre Count du CP0, un pas
+//                  tous les deux cycles SYSCLK), table statique.
+//
+//  PROFILE_BEGIN(zone) ... PROFILE_END(zone) : deux lectures de Count et
+//  un appel à PROFILE_Record() (une vingtaine de cycles). Une zone n'est
+//  instrumentée que dans un seul contexte (une ISR ou la boucle
+//  principale) : son début est mémorisé dans la table. La durée d'une
+//  zone comprend les interruptions plus prioritaires qui l'ont coupée.
+//
+//  Par zone : nombre, min, max, somme (moyenne), histogramme en
+//  puissances de 2 et budget facultatif (période de l'ISR) : le maximum
+//  est rapporté en pourcentage du budget.
+//
+//  PROFILE_ENABLE à 0 : macros vides, aucune table.
+//--------------------------------------------------------
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdint.h>
+#include <xc.h>
+#include "system_config.h"
+
+#ifndef PROFILE_ENABLE
+#define PROFILE_ENABLE      1
+#endif
+
+#define PROFILE_TICK_HZ     (SYS_CLK_FREQ / 2)  // Fréquence de Count
+#define PROFILE_BINS        12
+#define PROFILE_BIN_FIRST   4   // Case 0 : < 2^4 pas ; case k : [2^(k+3), 2^(k+4))
+
+// Durée (ns) -> pas de Count
+#define PROFILE_NS_TO_TICKS(ns) \
+    ((uint32_t)((uint64_t)(ns) * (PROFILE_TICK_HZ / 1000000ul) / 1000u))
+
+typedef enum
+{
+    PROFILE_SUPERV,         // Timer1 : APP_Supervisor (SUPERV_FREQ)
+    PROFILE_PWM,            // Timer2 : début de période PWM (ILIM)
+    PROFILE_REGUL,          // ADC : PI_Regulation
+    PROFILE_I2C,            // I2C1 : driver statique et client i2cbus
+    PROFILE_APP_TASKS,      // Boucle principale : APP_Tasks
+    PROFILE_ZONES
+} PROFILE_ZONE;
+
+typedef struct
+{
+    uint32_t start;         // Count au PROFILE_BEGIN
+    uint32_t count;
+    uint32_t min;           // Pas de Count
+    uint32_t max;
+    uint64_t sum;
+    uint32_t budget;        // 0 : sans budget
+    uint32_t hist[PROFILE_BINS];
+} PROFILE_STATS;
+
+#if PROFILE_ENABLE
+
+extern PROFILE_STATS profileZone[PROFILE_ZONES];
+
+#define PROFILE_BEGIN(zone) (profileZone[zone].start = _CP0_GET_COUNT())
+#define PROFILE_END(zone)   PROFILE_Record((zone), _CP0_GET_COUNT() - profileZone[zone].start)
+
+void PROFILE_Record(PROFILE_ZONE zone, uint32_t ticks);
+void PROFILE_BudgetSet(PROFILE_ZONE zone, uint32_t ticks);
+void PROFILE_Reset(void);
+
+// Copie cohérente d'une zone (interruptions masquées pendant la copie)
+void PROFILE_Get(PROFILE_ZONE zone, PROFILE_STATS *stats);
+
+// Rapport texte, une ligne par appel de line (sans '\n')
+void PROFILE_Dump(void (*line)(const char *text));
+
+#else
+
+#define PROFILE_BEGIN(zone)         do { } while (0)
+#define PROFILE_END(zone)           do { } while (0)
+#define PROFILE_BudgetSet(zone, t)  do { } while (0)
+#define PROFILE_Reset()             do { } while (0)
+#define PROFILE_Dump(line)          ((void)(line))
+
+#endif
+
+#endif
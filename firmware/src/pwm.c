@@ -0,0 +1,197 @@
+//--------------------------------------------------------
+//      pwm.c
+//--------------------------------------------------------
+//	Description :	Base de temps PWM et déclenchement synchrone de l'ADC
+//                  (voir pwm.h)
+//--------------------------------------------------------
+
+#include "app.h"
+#include "pwm.h"
+
+// Timer 16 bits ; 100 % (OC1RS = période) doit aussi tenir dans 16 bits
+#define PWM_TICKS_MAX   65535ul
+
+static const struct
+{
+    TMR_PRESCALE value;
+    uint16_t     divider;
+} pwmPrescale[] =
+{
+    { TMR_PRESCALE_VALUE_1,   1 },
+    { TMR_PRESCALE_VALUE_2,   2 },
+    { TMR_PRESCALE_VALUE_4,   4 },
+    { TMR_PRESCALE_VALUE_8,   8 },
+    { TMR_PRESCALE_VALUE_16,  16 },
+    { TMR_PRESCALE_VALUE_32,  32 },
+    { TMR_PRESCALE_VALUE_64,  64 },
+    { TMR_PRESCALE_VALUE_256, 256 },
+};
+
+#define PWM_PRESCALE_NB (sizeof(pwmPrescale) / sizeof(pwmPrescale[0]))
+
+// Configuration Harmony par défaut (DRV_TMR1_Initialize) : 100 Hz
+static uint32_t pwmTicks = 60000;
+static uint16_t pwmDivider = 8;
+static uint8_t  pwmBits = 15;
+static volatile uint16_t pwmCompare;    // Dernier OC1RS écrit
+
+//------------------------------------------------------------------------------
+// PWM_Configure
+//
+// Plus petit prescaler pour lequel la période tient dans 16 bits : la
+// résolution est la plus fine possible pour la fréquence demandée.
+//------------------------------------------------------------------------------
+
+bool PWM_Configure(uint32_t freqHz)
+{
+    uint32_t clk = SYS_CLK_BUS_PERIPHERAL_1;
+    uint32_t ticks = 0;
+    uint8_t i, bits;
+
+    if (freqHz == 0 || freqHz > PWM_FREQ_MAX)
+        return false;
+
+    for (i = 0; i < PWM_PRESCALE_NB; i++)
+    {
+        uint32_t div = pwmPrescale[i].divider;
+        // Arrondi au nombre pair de ticks le plus proche
+        ticks = ((clk / div + freqHz) / (2 * freqHz)) * 2;
+        if (ticks <= PWM_TICKS_MAX)
+            break;
+    }
+    if (i == PWM_PRESCALE_NB || ticks < 4)
+        return false;
+
+    for (bits = 0; (2ul << bits) <= ticks; bits++)
+        ;
+
+    pwmTicks = ticks;
+    pwmDivider = pwmPrescale[i].divider;
+    pwmBits = bits;
+
+    DRV_TMR1_ClockSet(DRV_TMR_CLKSOURCE_INTERNAL, pwmPrescale[i].value);
+    DRV_TMR1_PeriodValueSet(ticks - 1);
+    return true;
+}
+
+uint32_t PWM_FrequencyGet(void)
+{
+    return SYS_CLK_BUS_PERIPHERAL_1 / pwmDivider / pwmTicks;
+}
+
+uint32_t PWM_PeriodTicks(void)
+{
+    return pwmTicks;
+}
+
+uint32_t PWM_PeriodNs(void)
+{
+    return (uint32_t)(((uint64_t)pwmTicks * pwmDivider * 1000000000ull
+                       + SYS_CLK_BUS_PERIPHERAL_1 / 2) / SYS_CLK_BUS_PERIPHERAL_1);
+}
+
+uint8_t PWM_ResolutionBits(void)
+{
+    return pwmBits;
+}
+
+//------------------------------------------------------------------------------
+// PWM_DutySetFix
+//
+// OC1RS > PR2 : sortie toujours active (100 %)
+//------------------------------------------------------------------------------
+
+void PWM_DutySetFix(q31_t duty)
+{
+    PWM_DutySetTicks(Q31_Scale(duty, pwmTicks));
+}
+
+void PWM_DutySetTicks(uint32_t compare)
+{
+    pwmCompare = (uint16_t)compare;
+    DRV_OC0_PulseWidthSet(compare);
+}
+
+uint16_t PWM_DutyGet(void)
+{
+    return pwmCompare;
+}
+
+//------------------------------------------------------------------------------
+// PWM_SyncStart
+//
+// Timer2 est démarré juste après l'instant de déclenchement de Vout et
+// Timer3 à zéro : le premier débordement de Timer3 (T/2 plus tard) est
+// donc celui de Iout, ce qui aligne la séquence MUX A / MUX B de l'ADC.
+// Les deux timers ont le même prescaler : le décalage entre les deux
+// démarrages reste inférieur à un tick.
+// L'ADC interrompt après 2.decim conversions (decim paires Iout/Vout).
+//------------------------------------------------------------------------------
+
+bool PWM_SyncStart(q15_t trigPoint, uint8_t decim)
+{
+    uint32_t point = ((uint32_t)(trigPoint > 0 ? trigPoint : 0) * pwmTicks) >> 15;
+
+    if (decim == 0 || decim > PWM_DECIM_MAX)
+        return false;
+
+    PLIB_TMR_Stop(TMR_ID_2);
+    PLIB_TMR_Stop(TMR_ID_3);
+
+    // Timer3 : même horloge que Timer2, demi-période
+    PLIB_TMR_ClockSourceSelect(TMR_ID_3, TMR_CLOCK_SOURCE_PERIPHERAL_CLOCK);
+    PLIB_TMR_PrescaleSelect(TMR_ID_3, DRV_TMR1_PrescalerGet());
+    PLIB_TMR_Mode16BitEnable(TMR_ID_3);
+    PLIB_TMR_Period16BitSet(TMR_ID_3, (uint16_t)(pwmTicks / 2 - 1));
+
+    PLIB_TMR_Counter16BitSet(TMR_ID_3, 0);
+    PLIB_TMR_Counter16BitSet(TMR_ID_2, (uint16_t)point);
+
+    // ADC armé (échantillonnage auto, séquence et buffer remis à zéro)
+    DRV_ADC_Close();
+    PLIB_ADC_SamplesPerInterruptSelect(DRV_ADC_ID_1,
+            (ADC_SAMPLES_PER_INTERRUPT)(ADC_1SAMPLE_PER_INTERRUPT + 2 * decim - 1));
+    DRV_ADC_Open();
+    DRV_ADC_Start();
+
+    DRV_OC0_Start();
+    PLIB_TMR_Start(TMR_ID_3);
+    PLIB_TMR_Start(TMR_ID_2);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// PWM_FaultClear
+//
+// OCFLT n'est effacé que par la réécriture du mode (OCM), entrée OCFA
+// revenue au repos. Si le défaut est toujours présent, OCFLT remonte
+// aussitôt : le drapeau d'interruption est effacé pour ne pas compter
+// deux fois la même coupure.
+//------------------------------------------------------------------------------
+
+bool PWM_FaultClear(void)
+{
+    PLIB_OC_ModeSelect(OC_ID_1, OC_COMPARE_PWM_MODE_WITH_FAULT_PROTECTION);
+    if (DRV_OC0_FaultHasOccurred())
+    {
+        PLIB_INT_SourceFlagClear(INT_ID_0, INT_SOURCE_OUTPUT_COMPARE_1);
+        return false;
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// PWM_PulseTerminate
+//
+// Mode coupé puis PWM : OC1 est remis à zéro et ne repasse à un qu'au
+// prochain début de période de Timer2. Un défaut OCFA mémorisé n'est
+// pas touché (la réécriture effacerait OCFLT).
+//------------------------------------------------------------------------------
+
+void PWM_PulseTerminate(void)
+{
+    if (DRV_OC0_FaultHasOccurred())
+        return;
+    PLIB_OC_ModeSelect(OC_ID_1, OC_COMPARE_TURN_OFF_MODE);
+    PLIB_OC_ModeSelect(OC_ID_1, OC_COMPARE_PWM_MODE_WITH_FAULT_PROTECTION);
+}
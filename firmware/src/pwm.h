@@ -0,0 +1,80 @@
+//--------------------------------------------------------
+//      pwm.h
+//--------------------------------------------------------
+//	Description :	Base de temps PWM et déclenchement synchrone de l'ADC
+//
+//  Configuration : PWM_Configure(f) choisit le plus petit prescaler de
+//  Timer2 donnant une période <= 65535 ticks (résolution maximale ; le
+//  rapport de 100 %, OC1RS = période, tient dans 16 bits), la période
+//  est arrondie à un nombre pair de ticks. La résolution
+//  effective du rapport cyclique vaut floor(log2(ticks)) bits.
+//
+//  Synchronisation : Timer2 cadence OC1 (PWM). Timer3 tourne à la
+//  demi-période de Timer2, en phase fixe : ses débordements déclenchent
+//  les conversions ADC (SSRC = Timer3) aux instants
+//      point - T/2 : MUX A = AN12 (Iout)  -> ADC1BUF0 / BUF8
+//      point       : MUX B = AN11 (Vout)  -> ADC1BUF1 / BUF9
+//  L'interruption ADC tombe juste après la conversion de Vout : la loi
+//  de commande y est exécutée et OC1RS est pris en compte au début de la
+//  période suivante.
+//
+//  Décimation : avec decim périodes PWM par interruption ADC (SMPI =
+//  2.decim échantillons), la paire (Iout, Vout) la plus récente est aux
+//  index 2.decim-2 et 2.decim-1 de la moitié de buffer lue. La
+//  décimation est matérielle : aucune interruption n'est perdue à ne
+//  rien faire entre deux pas de régulation. decim <= PWM_DECIM_MAX
+//  (moitié de buffer de 8 mots).
+//
+//  Exemple : point = T/4 avec un rapport cyclique de 50 % échantillonne
+//  Vout au milieu de la conduction et Iout au milieu du blocage, loin
+//  des fronts de commutation.
+//
+//  Protection : OC1 est en mode PWM avec défaut. Une entrée OCFA basse
+//  force la sortie à zéro en quelques cycles, sans logiciel, et lève
+//  l'interruption OC1 ; la sortie reste coupée jusqu'à PWM_FaultClear().
+//  La réécriture du mode PWM remet aussi la sortie à zéro jusqu'à la fin
+//  de la période : c'est ainsi qu'une impulsion est tronquée.
+//
+//  Fréquence max : une conversion (15 + 12 TAD de 125 ns) par
+//  demi-période, soit PWM_FREQ_MAX.
+//--------------------------------------------------------
+
+#ifndef PWM_H
+#define PWM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "fixmath.h"
+
+#define PWM_FREQ_MAX    140000ul    // Hz, limité par l'ADC
+#define PWM_DECIM_MAX   4           // Périodes PWM par interruption ADC
+
+// Période et prescaler de Timer2 pour la fréquence demandée (Hz) ;
+// faux si hors plage. A appeler avant PWM_SyncStart.
+bool     PWM_Configure(uint32_t freqHz);
+
+uint32_t PWM_FrequencyGet(void);        // Fréquence effective (Hz)
+uint32_t PWM_PeriodTicks(void);         // PR2 + 1
+uint32_t PWM_PeriodNs(void);            // Période effective (ns)
+uint8_t  PWM_ResolutionBits(void);      // Résolution du rapport cyclique
+
+// Rapport cyclique Q31 (0 = 0 %, Q31_MAX = 100 %) -> OC1RS
+void     PWM_DutySetFix(q31_t duty);
+
+// OC1RS en ticks de Timer2 (> PWM_PeriodTicks() - 1 : 100 %)
+void     PWM_DutySetTicks(uint32_t compare);
+uint16_t PWM_DutyGet(void);             // Dernier OC1RS écrit (télémétrie)
+
+// Démarre OC1/Timer2/Timer3/ADC en phase ; point : fraction de période,
+// decim : périodes PWM par interruption ADC (1..PWM_DECIM_MAX)
+bool     PWM_SyncStart(q15_t trigPoint, uint8_t decim);
+
+// Réarme OC1 après un défaut OCFA ; faux si l'entrée est toujours active
+// (la sortie reste coupée, aucune nouvelle interruption en attente)
+bool     PWM_FaultClear(void);
+
+// Tronque l'impulsion en cours (sortie à zéro jusqu'à la période
+// suivante) ; sans effet pendant un défaut OCFA
+void     PWM_PulseTerminate(void);
+
+#endif
@@ -0,0 +1,139 @@
+//--------------------------------------------------------
+//      regul.c
+//--------------------------------------------------------
+//	Description :	Moteur de régulation PI (fixe Q31 et référence float)
+//                  Voir regul.h pour les formats.
+//--------------------------------------------------------
+
+#include "regul.h"
+
+//------------------------------------------------------------------------------
+// Référence flottante (PI_AW_NONE : comportement de l'ancien PI_Regulation)
+// Anti-emballement écrit pour ki > 0 : le signe de l'incrément intégral
+// est celui de l'erreur.
+
+void PI_AntiWindupFloat(PI_FLOAT_PARAM *p, PI_AW_MODE mode, float tt)
+{
+    p->aw = mode;
+    p->kt = (tt > 0.0f) ? p->dt / tt : 0.0f;
+}
+
+void PI_ResetFloat(PI_FLOAT_STATE *s)
+{
+    s->integrale = 0.0f;
+}
+
+void PI_PreloadFloat(const PI_FLOAT_PARAM *p, PI_FLOAT_STATE *s, float out)
+{
+    s->integrale = (p->ki > 0.0f) ? out / p->ki : 0.0f;
+}
+
+float PI_StepFloat(const PI_FLOAT_PARAM *p, PI_FLOAT_STATE *s, float error)
+{
+    float prop = p->kp * error;
+    float integ = s->integrale + error * p->dt; // Accumuler erreur pour le I
+    float output = prop + p->ki * integ;
+    float unsat;
+
+    switch (p->aw)
+    {
+        case PI_AW_CLAMP:
+            // Pas d'intégration si elle aggrave la saturation
+            if ((output > p->outMax && error > 0.0f) ||
+                (output < p->outMin && error < 0.0f))
+                integ = s->integrale;
+            break;
+
+        case PI_AW_FREEZE:
+            unsat = prop + p->ki * s->integrale;
+            if (unsat > p->outMax || unsat < p->outMin)
+                integ = s->integrale;
+            break;
+
+        default:
+            break;
+    }
+    output = prop + p->ki * integ;
+
+    // Saturation de la sortie
+    unsat = output;
+    if (output > p->outMax) output = p->outMax;
+    if (output < p->outMin) output = p->outMin;
+
+    if (p->aw == PI_AW_BACKCALC && p->ki > 0.0f)
+        integ += p->kt * (output - unsat) / p->ki;
+
+    s->integrale = integ;
+    return output;
+}
+
+//------------------------------------------------------------------------------
+// Version virgule fixe
+// Coût : 2 MULT 32x32->64 + saturations (3 avec PI_AW_BACKCALC), aucun
+// appel de bibliothèque. La sortie non bornée est évaluée sur 64 bits :
+// la saturation à Q31_MAX de l'addition masquerait un outMax de 1.0.
+
+void PI_InitFix(PI_FIX_PARAM *p, float kp, float ki, float dt, float lsb,
+               float outMin, float outMax)
+{
+    p->kp = Q31(kp * lsb);
+    p->kiDt = Q31(ki * dt * lsb);
+    p->outMin = Q31(outMin);
+    p->outMax = Q31(outMax);
+    p->aw = PI_AW_NONE;
+    p->kt = 0;
+}
+
+void PI_AntiWindupFix(PI_FIX_PARAM *p, PI_AW_MODE mode, float dt, float tt)
+{
+    p->aw = mode;
+    p->kt = (tt > 0.0f) ? Q31(dt / tt) : 0;
+}
+
+void PI_ResetFix(PI_FIX_STATE *s)
+{
+    s->integ = 0;
+}
+
+void PI_PreloadFix(PI_FIX_STATE *s, q31_t out)
+{
+    s->integ = out;
+}
+
+q31_t PI_StepFix(const PI_FIX_PARAM *p, PI_FIX_STATE *s, int32_t errorCode)
+{
+    q31_t inc = Q31_MulInt(p->kiDt, errorCode);
+    q31_t prop = Q31_MulInt(p->kp, errorCode);
+    q31_t integ = s->integ;
+    int64_t unsat;
+    q31_t output;
+
+    switch (p->aw)
+    {
+        case PI_AW_CLAMP:
+            unsat = (int64_t)prop + Q31_Add(integ, inc);
+            if (!((unsat > p->outMax && inc > 0) || (unsat < p->outMin && inc < 0)))
+                integ = Q31_Add(integ, inc);
+            break;
+
+        case PI_AW_FREEZE:
+            unsat = (int64_t)prop + integ;
+            if (unsat <= p->outMax && unsat >= p->outMin)
+                integ = Q31_Add(integ, inc);
+            break;
+
+        default:
+            // Terme intégral saturé à +-1, ce qui borne déjà l'emballement
+            integ = Q31_Add(integ, inc);
+            break;
+    }
+
+    unsat = (int64_t)prop + integ;
+    output = Q31_Limit(Q31_Sat(unsat), p->outMin, p->outMax);
+
+    if (p->aw == PI_AW_BACKCALC)
+        integ = Q31_Add(integ, Q31_Mul(p->kt, Q31_Sat((int64_t)output - unsat)));
+
+    s->integ = integ;
+    return output;
+}
@@ -0,0 +1,96 @@
+//--------------------------------------------------------
+//      regul.h
+//--------------------------------------------------------
+//	Description :	Moteur de régulation PI
+//                  - PI_StepFix   : virgule fixe Q31 (utilisé dans l'ISR)
+//                  - PI_StepFloat : référence flottante, conservée pour
+//                                   comparaison avec la version fixe
+//
+//  Les deux versions calculent la même loi :
+//      integrale += erreur * DT
+//      sortie     = KP * erreur + KI * integrale,  limitée à [min, max]
+//
+//  Version fixe : l'erreur est en codes ADC, les gains sont pré-multipliés
+//  par le LSB de mesure (V/code) et exprimés en Q31 de rapport cyclique.
+//  L'état intégral stocke directement KI * integrale (Q31, saturé).
+//--------------------------------------------------------
+
+#ifndef REGUL_H
+#define REGUL_H
+
+#include <stdint.h>
+#include "fixmath.h"
+
+// === Anti-emballement du terme intégral (sortie saturée) ===
+typedef enum
+{
+    PI_AW_NONE = 0,     // Intégration permanente (bornée à +-1 en fixe)
+    PI_AW_CLAMP,        // Intégration conditionnelle : suspendue si elle
+                        // pousse la sortie plus loin dans la saturation
+    PI_AW_BACKCALC,     // Retour de l'écart sortie bornée - non bornée
+                        // avec le gain de poursuite kt = DT / Tt
+    PI_AW_FREEZE        // Intégrateur figé tant que la sortie est bornée
+} PI_AW_MODE;
+
+// === Référence flottante ===
+typedef struct
+{
+    float kp;           // Gain proportionnel
+    float ki;           // Gain intégral
+    float dt;           // Période d'échantillonnage (s)
+    float outMin;       // Limite basse de la sortie
+    float outMax;       // Limite haute de la sortie
+    PI_AW_MODE aw;      // Anti-emballement
+    float kt;           // Gain de poursuite (PI_AW_BACKCALC)
+} PI_FLOAT_PARAM;
+
+typedef struct
+{
+    float integrale;    // Somme de erreur * DT
+} PI_FLOAT_STATE;
+
+// === Virgule fixe ===
+typedef struct
+{
+    q31_t kp;           // KP * LSB       (Q31 de sortie par code)
+    q31_t kiDt;         // KI * DT * LSB  (Q31 de sortie par code)
+    q31_t outMin;       // Limite basse de la sortie (Q31)
+    q31_t outMax;       // Limite haute de la sortie (Q31)
+    PI_AW_MODE aw;      // Anti-emballement
+    q31_t kt;           // Gain de poursuite DT / Tt (PI_AW_BACKCALC)
+} PI_FIX_PARAM;
+
+typedef struct
+{
+    q31_t integ;        // KI * integrale (Q31)
+} PI_FIX_STATE;
+
+// Construction des paramètres fixes à partir des gains réels.
+// lsb : unité physique d'un code de l'erreur (ex. V/code)
+// Toutes les expressions sont constantes -> évaluées à la compilation.
+#define PI_FIX_PARAM_INIT(kp, ki, dt, lsb, outMin, outMax) \
+    { Q31((kp) * (lsb)), Q31((ki) * (dt) * (lsb)), Q31(outMin), Q31(outMax), \
+      PI_AW_NONE, 0 }
+
+// Même calcul à l'exécution, quand DT dépend de la configuration (appelé
+// une fois au démarrage, hors ISR : le flottant n'y coûte rien)
+void  PI_InitFix(PI_FIX_PARAM *p, float kp, float ki, float dt, float lsb,
+                 float outMin, float outMax);
+
+// Choix de l'anti-emballement ; tt : constante de temps de poursuite (s),
+// utilisée par PI_AW_BACKCALC (usuellement de l'ordre de Ti = KP / KI)
+void  PI_AntiWindupFix(PI_FIX_PARAM *p, PI_AW_MODE mode, float dt, float tt);
+void  PI_AntiWindupFloat(PI_FLOAT_PARAM *p, PI_AW_MODE mode, float tt);
+
+// Préchargement : sortie de valeur 'out' pour une erreur nulle (reprise
+// sans à-coup, soft-start)
+void  PI_PreloadFloat(const PI_FLOAT_PARAM *p, PI_FLOAT_STATE *s, float out);
+void  PI_PreloadFix(PI_FIX_STATE *s, q31_t out);
+
+void  PI_ResetFloat(PI_FLOAT_STATE *s);
+float PI_StepFloat(const PI_FLOAT_PARAM *p, PI_FLOAT_STATE *s, float error);
+
+void  PI_ResetFix(PI_FIX_STATE *s);
+q31_t PI_StepFix(const PI_FIX_PARAM *p, PI_FIX_STATE *s, int32_t errorCode);
+
+#endif
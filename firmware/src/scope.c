@@ -0,0 +1,178 @@
+//--------------------------------------------------------
+//      scope.c
+//--------------------------------------------------------
+//	Description :	Capture déclenchée des signaux de régulation
+//                  (voir scope.h)
+//
+//  SCOPE_Sample() s'exécute dans l'ISR de régulation, les autres
+//  fonctions dans la boucle principale. L'armement passe d'abord l'état
+//  à SCOPE_IDLE : l'ISR, plus prioritaire, n'écrit plus rien tant que la
+//  configuration est recopiée ; SCOPE_ARMED est publié en dernier.
+//--------------------------------------------------------
+
+#include "scope.h"
+
+#define SCOPE_MASK          (SCOPE_DEPTH - 1)
+
+#if (SCOPE_DEPTH & SCOPE_MASK) != 0
+#error "SCOPE_DEPTH doit être une puissance de 2"
+#endif
+
+static SCOPE_SAMPLE scopeBuffer[SCOPE_DEPTH];
+static SCOPE_CONFIG scopeCfg;
+static volatile uint8_t scopeState;     // SCOPE_STATE
+static volatile bool scopeForce;
+static uint16_t scopeHead;              // Prochaine place
+static uint16_t scopeCount;             // Acquis depuis l'armement (<= SCOPE_DEPTH)
+static uint16_t scopePost;              // Restant à acquérir après déclenchement
+static uint16_t scopeTrig;              // Place de l'échantillon déclencheur
+static uint8_t  scopeSkip;              // Pas à sauter avant le prochain échantillon
+static int16_t  scopePrev;              // Source au pas précédent
+static bool     scopePrevFault;
+static bool     scopePrevValid;
+static uint32_t scopeStep;              // Pas de régulation
+static uint32_t scopeTrigStep;
+
+static int16_t _Source(const SCOPE_SAMPLE *s)
+{
+    switch (scopeCfg.source)
+    {
+        case SCOPE_SRC_IOUT:  return (int16_t)s->iOut;
+        case SCOPE_SRC_ERROR: return s->error;
+        case SCOPE_SRC_INTEG: return s->integ;
+        case SCOPE_SRC_DUTY:  return (int16_t)s->duty;
+        default:              return (int16_t)s->vOut;
+    }
+}
+
+// Condition de déclenchement entre le pas précédent et celui-ci
+static bool _Fire(int16_t x, bool fault)
+{
+    int16_t level = scopeCfg.level;
+
+    switch (scopeCfg.trigger)
+    {
+        case SCOPE_TRIG_RISING:
+            return scopePrev < level && x >= level;
+        case SCOPE_TRIG_FALLING:
+            return scopePrev > level && x <= level;
+        case SCOPE_TRIG_SLOPE:
+            return level >= 0 ? x - scopePrev >= level : x - scopePrev <= level;
+        case SCOPE_TRIG_FAULT:
+            return fault && !scopePrevFault;
+        default:
+            return false;
+    }
+}
+
+//------------------------------------------------------------------------------
+// SCOPE_Sample
+//
+// Un appel par pas de régulation : évaluation du déclenchement, puis
+// écriture d'un échantillon si la décimation le prévoit.
+//------------------------------------------------------------------------------
+
+void SCOPE_Sample(const SCOPE_SAMPLE *s, bool fault)
+{
+    uint8_t state = scopeState;
+    int16_t x;
+
+    scopeStep++;
+    if (state != SCOPE_ARMED && state != SCOPE_TRIGGERED)
+        return;
+
+    x = _Source(s);
+    if (state == SCOPE_ARMED && scopeCount >= scopeCfg.pre
+        && (scopeForce || (scopePrevValid && _Fire(x, fault))))
+    {
+        state = SCOPE_TRIGGERED;
+        scopeForce = false;
+        scopeTrig = scopeHead;
+        scopeTrigStep = scopeStep;
+        scopePost = SCOPE_DEPTH - scopeCfg.pre;
+        scopeSkip = 0;                  // L'échantillon déclencheur est gardé
+    }
+    scopePrev = x;
+    scopePrevFault = fault;
+    scopePrevValid = true;
+
+    if (scopeSkip != 0)
+    {
+        scopeSkip--;
+        return;
+    }
+    scopeSkip = scopeCfg.decim - 1;
+    scopeBuffer[scopeHead] = *s;
+    scopeHead = (scopeHead + 1) & SCOPE_MASK;
+    if (scopeCount < SCOPE_DEPTH)
+        scopeCount++;
+    if (state == SCOPE_TRIGGERED && --scopePost == 0)
+        state = SCOPE_DONE;             // Figée jusqu'au prochain armement
+    scopeState = state;
+}
+
+//------------------------------------------------------------------------------
+// Commande (boucle principale)
+//------------------------------------------------------------------------------
+
+void SCOPE_Arm(const SCOPE_CONFIG *cfg)
+{
+    scopeState = SCOPE_IDLE;
+    scopeCfg = *cfg;
+    if (scopeCfg.pre >= SCOPE_DEPTH)
+        scopeCfg.pre = SCOPE_DEPTH - 1;
+    if (scopeCfg.decim == 0)
+        scopeCfg.decim = 1;
+    scopeHead = 0;
+    scopeCount = 0;
+    scopeSkip = 0;
+    scopePrevValid = false;
+    scopeForce = false;
+    scopeState = SCOPE_ARMED;
+}
+
+// Arrêt sans déclenchement : l'anneau reste relisible
+void SCOPE_Stop(void)
+{
+    scopeState = SCOPE_IDLE;
+}
+
+void SCOPE_Force(void)
+{
+    scopeForce = true;
+}
+
+//------------------------------------------------------------------------------
+// Relecture
+//------------------------------------------------------------------------------
+
+SCOPE_STATE SCOPE_State(void)
+{
+    return (SCOPE_STATE)scopeState;
+}
+
+uint16_t SCOPE_Length(void)
+{
+    return scopeCount;
+}
+
+uint16_t SCOPE_TriggerIndex(void)
+{
+    return (uint16_t)(scopeTrig - (scopeHead - scopeCount)) & SCOPE_MASK;
+}
+
+uint32_t SCOPE_TriggerStep(void)
+{
+    return scopeTrigStep;
+}
+
+// Echantillon index (0 : le plus ancien) ; refusé pendant l'acquisition
+bool SCOPE_Read(uint16_t index, SCOPE_SAMPLE *s)
+{
+    uint8_t state = scopeState;
+
+    if (state == SCOPE_ARMED || state == SCOPE_TRIGGERED || index >= scopeCount)
+        return false;
+    *s = scopeBuffer[(uint16_t)(scopeHead - scopeCount + index) & SCOPE_MASK];
+    return true;
+}
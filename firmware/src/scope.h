@@ -0,0 +1,105 @@
+//--------------------------------------------------------
+//      scope.h
+//--------------------------------------------------------
+//	Description :	Capture déclenchée des signaux de régulation
+//                  (oscilloscope en RAM)
+//                  Un échantillon par pas de régulation (ou tous les
+//                  decim pas) dans un anneau de SCOPE_DEPTH places ; au
+//                  déclenchement, post = SCOPE_DEPTH - pre échantillons
+//                  sont encore enregistrés, puis la capture est figée
+//                  jusqu'au prochain SCOPE_Arm().
+//
+//  Déclenchement, évalué à chaque pas (même entre deux échantillons
+//  décimés ; l'échantillon déclencheur est toujours enregistré) :
+//      SCOPE_TRIG_RISING   la source passe de < level à >= level
+//      SCOPE_TRIG_FALLING  la source passe de > level à <= level
+//      SCOPE_TRIG_SLOPE    variation en un pas >= level (level > 0)
+//                          ou <= level (level < 0)
+//      SCOPE_TRIG_FAULT    entrée en défaut (étage coupé)
+//  Le déclenchement n'est accepté qu'une fois pre échantillons acquis
+//  depuis l'armement : la pré-histoire est toujours complète.
+//  SCOPE_Force() déclenche au pas suivant (capture manuelle).
+//
+//  RAM : SCOPE_DEPTH x 10 octets (5 ko), soit 51 ms à 10 kHz sans
+//  décimation. Le PIC32MX130F064B n'a que 16 ko de RAM au total.
+//
+//  Relecture (boucle principale, débogueur) : SCOPE_Read() rend les
+//  échantillons dans l'ordre chronologique ; l'échantillon déclencheur
+//  est à l'indice SCOPE_TriggerIndex().
+//--------------------------------------------------------
+
+#ifndef SCOPE_H
+#define SCOPE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SCOPE_DEPTH         512         // Echantillons (puissance de 2)
+
+typedef enum
+{
+    SCOPE_SRC_VOUT,                     // Code AN11
+    SCOPE_SRC_IOUT,                     // Code AN12
+    SCOPE_SRC_ERROR,                    // Consigne - Vout (codes AN11)
+    SCOPE_SRC_INTEG,                    // Terme intégral (Q15)
+    SCOPE_SRC_DUTY                      // OC1RS
+} SCOPE_SOURCE;
+
+typedef enum
+{
+    SCOPE_TRIG_RISING,
+    SCOPE_TRIG_FALLING,
+    SCOPE_TRIG_SLOPE,
+    SCOPE_TRIG_FAULT
+} SCOPE_TRIGGER;
+
+typedef enum
+{
+    SCOPE_IDLE,                         // Arrêté, rien de capturé
+    SCOPE_ARMED,                        // Pré-déclenchement, en attente
+    SCOPE_TRIGGERED,                    // Post-déclenchement en cours
+    SCOPE_DONE                          // Capture figée, à relire
+} SCOPE_STATE;
+
+typedef struct
+{
+    uint8_t  source;        // SCOPE_SOURCE
+    uint8_t  trigger;       // SCOPE_TRIGGER
+    int16_t  level;         // Seuil ou pente, unité de la source
+    uint16_t pre;           // Echantillons avant le déclenchement (< SCOPE_DEPTH)
+    uint8_t  decim;         // Un échantillon tous les decim pas (>= 1)
+} SCOPE_CONFIG;
+
+// Echantillon (même unités que la régulation)
+typedef struct
+{
+    uint16_t vOut;          // Code AN11
+    uint16_t iOut;          // Code AN12
+    int16_t  error;         // Consigne - Vout (codes AN11)
+    int16_t  integ;         // Terme intégral ou sortie du compensateur (Q15)
+    uint16_t duty;          // OC1RS
+} SCOPE_SAMPLE;
+
+// (Ré)armement ; la capture précédente est perdue
+void        SCOPE_Arm(const SCOPE_CONFIG *cfg);
+void        SCOPE_Stop(void);
+void        SCOPE_Force(void);
+
+// ISR de régulation : un appel par pas
+void        SCOPE_Sample(const SCOPE_SAMPLE *s, bool fault);
+
+SCOPE_STATE SCOPE_State(void);
+uint16_t    SCOPE_Length(void);         // Echantillons relisibles
+uint16_t    SCOPE_TriggerIndex(void);   // Indice de l'échantillon déclencheur
+uint32_t    SCOPE_TriggerStep(void);    // Pas de régulation du déclenchement
+bool        SCOPE_Read(uint16_t index, SCOPE_SAMPLE *s);  // Capture figée
+
+// Terme intégral flottant (fraction de pleine échelle) -> Q15 saturé
+static inline int16_t SCOPE_FloatQ15(float x)
+{
+    if (x >= 32767.0f / 32768.0f) return 32767;
+    if (x <= -1.0f) return -32768;
+    return (int16_t)(x * 32768.0f);
+}
+
+#endif
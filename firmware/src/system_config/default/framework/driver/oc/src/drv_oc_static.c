@@ -51,6 +51,7 @@ SUBSTITUTE GOODS, TECHNOLOGY, SERVOCES, OR ANY CLAIMS BY THIRD PARTIES
 // *****************************************************************************
 // *****************************************************************************
 #include "peripheral/oc/plib_oc.h"
+#include "peripheral/int/plib_int.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -60,11 +61,17 @@ SUBSTITUTE GOODS, TECHNOLOGY, SERVOCES, OR ANY CLAIMS BY THIRD PARTIES
 void DRV_OC0_Initialize(void)
 {
     /* Setup OC0 Instance */
-    PLIB_OC_ModeSelect(OC_ID_1, OC_COMPARE_PWM_MODE_WITHOUT_FAULT_PROTECTION);
+    PLIB_OC_ModeSelect(OC_ID_1, OC_COMPARE_PWM_MODE_WITH_FAULT_PROTECTION);
     PLIB_OC_BufferSizeSelect(OC_ID_1, OC_BUFFER_SIZE_16BIT);
     PLIB_OC_TimerSelect(OC_ID_1, OC_TIMER_16BIT_TMR2);
     PLIB_OC_Buffer16BitSet(OC_ID_1, 0);
     PLIB_OC_PulseWidth16BitSet(OC_ID_1, 59999);
+
+    /* Setup Interrupt : fault (OCFA) */
+    PLIB_INT_VectorPrioritySet(INT_ID_0, INT_VECTOR_OC1, INT_PRIORITY_LEVEL7);
+    PLIB_INT_VectorSubPrioritySet(INT_ID_0, INT_VECTOR_OC1, INT_SUBPRIORITY_LEVEL0);
+    PLIB_INT_SourceFlagClear(INT_ID_0, INT_SOURCE_OUTPUT_COMPARE_1);
+    PLIB_INT_SourceEnable(INT_ID_0, INT_SOURCE_OUTPUT_COMPARE_1);
 }
 
 void DRV_OC0_Enable(void)
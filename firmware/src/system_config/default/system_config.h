@@ -100,9 +100,9 @@ extern "C" {
 #define SYS_PORT_B_TRIS         0x3F8E
 #define SYS_PORT_B_LAT          0x0000
 #define SYS_PORT_B_ODC          0x0000
-#define SYS_PORT_B_CNPU         0x0000
+#define SYS_PORT_B_CNPU         0x0080
 #define SYS_PORT_B_CNPD         0x0000
-#define SYS_PORT_B_CNEN         0x0000
+#define SYS_PORT_B_CNEN         0x0080
 
 
 /*** Interrupt System Service Configuration ***/
@@ -114,6 +114,32 @@ extern "C" {
 // *****************************************************************************
 // *****************************************************************************
 #define DRV_OC_DRIVER_MODE_STATIC 
+/*** I2C Driver Configuration ***/
+#define DRV_I2C_INTERRUPT_MODE                    		true
+#define DRV_I2C_CLIENTS_NUMBER                    		1
+#define DRV_I2C_INSTANCES_NUMBER                  		1
+
+#define DRV_I2C_PERIPHERAL_ID_IDX0                		I2C_ID_1
+#define DRV_I2C_OPERATION_MODE_IDX0               		DRV_I2C_MODE_MASTER
+#define DRV_SCL_PORT_IDX0                               PORT_CHANNEL_B
+#define DRV_SCL_PIN_POSITION_IDX0                       PORTS_BIT_POS_8
+#define DRV_SDA_PORT_IDX0                               PORT_CHANNEL_B
+#define DRV_SDA_PIN_POSITION_IDX0                       PORTS_BIT_POS_9
+#define DRV_I2C_BIT_BANG_IDX0                           false
+#define DRV_I2C_STOP_IN_IDLE_IDX0                       false
+#define DRV_I2C_SMBus_SPECIFICATION_IDX0			    false
+#define DRV_I2C_BAUD_RATE_IDX0                    		50000
+#define DRV_I2C_BRG_CLOCK_IDX0	                  		48000000
+#define DRV_I2C_SLEW_RATE_CONTROL_IDX0      			false
+#define DRV_I2C_MASTER_INT_SRC_IDX0               		INT_SOURCE_I2C_1_MASTER
+#define DRV_I2C_SLAVE_INT_SRC_IDX0                		
+#define DRV_I2C_ERR_MX_INT_SRC_IDX0               		INT_SOURCE_I2C_1_ERROR
+#define DRV_I2C_INT_VECTOR_IDX0                   		INT_VECTOR_I2C1
+#define DRV_I2C_ISR_VECTOR_IDX0                         _I2C_1_VECTOR
+#define DRV_I2C_INT_PRIORITY_IDX0                 		INT_PRIORITY_LEVEL1
+#define DRV_I2C_INT_SUB_PRIORITY_IDX0             		INT_SUBPRIORITY_LEVEL0
+#define DRV_I2C_POWER_STATE_IDX0                  		SYS_MODULE_POWER_RUN_FULL
+
 /*** Timer Driver Configuration ***/
 #define DRV_TMR_INTERRUPT_MODE             true
 
@@ -144,6 +144,7 @@ void SYS_Initialize ( void* data )
     SYS_DEVCON_JTAGEnable();
 
     /* Initialize Drivers */
+    DRV_I2C0_Initialize();
 
     /* Initialize ADC */
     DRV_ADC_Initialize();
@@ -62,6 +62,7 @@ SUBSTITUTE GOODS, TECHNOLOGY, SERVICES, OR ANY CLAIMS BY THIRD PARTIES
 #include "system/common/sys_common.h"
 #include "app.h"
 #include "system_definitions.h"
+#include "profile.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -73,13 +74,40 @@ SUBSTITUTE GOODS, TECHNOLOGY, SERVICES, OR ANY CLAIMS BY THIRD PARTIES
 
 void __ISR(_TIMER_1_VECTOR, ipl1AUTO) IntHandlerDrvTmrInstance0(void)
 {   
+    App_Timer0Callback();
     PLIB_INT_SourceFlagClear(INT_ID_0,INT_SOURCE_TIMER_1);
 }
-void __ISR(_TIMER_2_VECTOR, ipl1AUTO) IntHandlerDrvTmrInstance1(void)
+void __ISR(_TIMER_2_VECTOR, ipl7AUTO) IntHandlerDrvTmrInstance1(void)
 {
     App_Timer1Callback();
     PLIB_INT_SourceFlagClear(INT_ID_0,INT_SOURCE_TIMER_2);
 }
+void __ISR(_ADC_VECTOR, ipl2AUTO) IntHandlerDrvAdc(void)
+{
+    App_AdcCallback();
+    PLIB_INT_SourceFlagClear(INT_ID_0,INT_SOURCE_ADC_1);
+}
+void __ISR(_OUTPUT_COMPARE_1_VECTOR, ipl7AUTO) IntHandlerDrvOCInstance0(void)
+{
+    App_OcFaultCallback();
+    PLIB_INT_SourceFlagClear(INT_ID_0,INT_SOURCE_OUTPUT_COMPARE_1);
+}
+void __ISR(_I2C_1_VECTOR, ipl1AUTO) IntHandlerDrvI2CInstance0(void)
+{
+    PROFILE_BEGIN(PROFILE_I2C);
+    DRV_I2C0_Tasks();
+    PROFILE_END(PROFILE_I2C);
+}
+void __ISR(_CHANGE_NOTICE_VECTOR, ipl1AUTO) IntHandlerChangeNotification(void)
+{
+    App_AlertCallback();
+    PLIB_INT_SourceFlagClear(INT_ID_0,INT_SOURCE_CHANGE_NOTICE_B);
+}
+void __ISR(_COMPARATOR_1_VECTOR, ipl7AUTO) IntHandlerCmpInstance0(void)
+{
+    App_CmpCallback();
+    PLIB_INT_SourceFlagClear(INT_ID_0,INT_SOURCE_COMPARATOR_1);
+}
  
  /*******************************************************************************
  End of File
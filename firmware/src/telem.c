@@ -0,0 +1,276 @@
+//--------------------------------------------------------
+//      telem.c
+//--------------------------------------------------------
+//	Description :	Télémétrie binaire sur UART1 par DMA (voir telem.h)
+//
+//  PIC32MX1xx : pas de cache de données, le DMA lit directement les
+//  tampons de trame en RAM (adresse physique).
+//--------------------------------------------------------
+
+#include <string.h>
+#include <sys/kmem.h>
+#include "system_config.h"
+#include "telem.h"
+#include "peripheral/usart/plib_usart.h"
+#include "peripheral/dma/plib_dma.h"
+
+#define TELEM_DMA_CH        DMA_CHANNEL_0
+#define TELEM_HEADER        4
+#define TELEM_RAW_MAX       (TELEM_HEADER + TELEM_BATCH * TELEM_SAMPLE_SIZE + 2)
+#define TELEM_FRAME_MAX     (TELEM_RAW_MAX + 2)     // Code COBS, délimiteur
+
+#if TELEM_RAW_MAX > 254
+#error "TELEM_BATCH : une trame doit tenir dans un seul bloc COBS"
+#endif
+
+typedef struct
+{
+    uint8_t  data[TELEM_FRAME_MAX];
+    uint8_t  len;
+    uint8_t  samples;
+} TELEM_FRAME;
+
+TELEM_RING_BUFFER telemRing;
+
+static TELEM_FRAME telemFrame[2];   // File de deux trames
+static uint8_t  telemOut;           // Plus ancienne trame (émise ou à émettre)
+static uint8_t  telemCount;         // Trames prêtes
+static bool     telemBusy;          // Transfert DMA en cours
+static uint16_t telemInfoIn;        // Trames avant la prochaine INFO
+static TELEM_INFO telemInfo;
+static TELEM_STATS telemStats;
+
+// CRC-16/CCITT-FALSE, table en flash
+static const uint16_t telemCrcTable[256] =
+{
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+    0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+    0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+    0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+    0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+    0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+    0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+    0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+    0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+    0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+    0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+    0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+    0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+    0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+    0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0,
+};
+
+static uint16_t _Crc16(const uint8_t *p, uint8_t n)
+{
+    uint16_t crc = 0xFFFF;
+
+    while (n--)
+        crc = (uint16_t)(crc << 8) ^ telemCrcTable[(uint8_t)(crc >> 8) ^ *p++];
+    return crc;
+}
+
+// COBS : chaque 0x00 est remplacé par la distance au suivant ; n < 255,
+// un seul bloc. Retourne la longueur encodée, délimiteur compris.
+static uint8_t _Cobs(const uint8_t *src, uint8_t n, uint8_t *dst)
+{
+    uint8_t *start = dst;
+    uint8_t *code = dst++;
+    uint8_t run = 1;
+
+    while (n--)
+    {
+        uint8_t b = *src++;
+
+        if (b == 0)
+        {
+            *code = run;
+            code = dst++;
+            run = 1;
+        }
+        else
+        {
+            *dst++ = b;
+            run++;
+        }
+    }
+    *code = run;
+    *dst++ = 0x00;
+    return (uint8_t)(dst - start);
+}
+
+// CRC, encodage et mise en file de la trame brute raw[0..n-1]
+static void _Queue(uint8_t *raw, uint8_t n, uint8_t samples)
+{
+    TELEM_FRAME *f = &telemFrame[(telemOut + telemCount) & 1];
+    uint16_t crc = _Crc16(raw, n);
+
+    raw[n++] = (uint8_t)crc;
+    raw[n++] = (uint8_t)(crc >> 8);
+    f->len = _Cobs(raw, n, f->data);
+    f->samples = samples;
+    telemCount++;
+}
+
+static void _QueueInfo(void)
+{
+    uint8_t raw[TELEM_RAW_MAX];
+
+    raw[0] = TELEM_FRAME_INFO;
+    raw[1] = TELEM_VERSION;
+    raw[2] = (uint8_t)telemInfo.sampleHz;
+    raw[3] = (uint8_t)(telemInfo.sampleHz >> 8);
+    memcpy(&raw[4], &telemInfo.lsbVout, 4);
+    memcpy(&raw[8], &telemInfo.lsbIout, 4);
+    raw[12] = (uint8_t)telemInfo.dutyFull;
+    raw[13] = (uint8_t)(telemInfo.dutyFull >> 8);
+    raw[14] = telemInfo.integFormat;
+    raw[15] = (uint8_t)telemInfo.ilimmA;
+    raw[16] = (uint8_t)(telemInfo.ilimmA >> 8);
+    memcpy(&raw[17], &telemInfo.ilimCount, 4);
+    _Queue(raw, 21, 0);
+}
+
+// TELEM_BATCH échantillons de l'anneau ; la place n'est rendue à l'ISR
+// qu'après la copie (barrière avant l'écriture de tail)
+static void _QueueSamples(void)
+{
+    uint8_t raw[TELEM_RAW_MAX];
+    uint16_t tail = telemRing.tail;
+    uint16_t dropped = telemRing.dropped;
+    uint8_t i;
+
+    raw[0] = TELEM_FRAME_SAMPLES;
+    raw[1] = TELEM_BATCH;
+    raw[2] = (uint8_t)dropped;
+    raw[3] = (uint8_t)(dropped >> 8);
+    for (i = 0; i < TELEM_BATCH; i++, tail++)
+        memcpy(&raw[TELEM_HEADER + i * TELEM_SAMPLE_SIZE],
+               &telemRing.sample[tail & (TELEM_RING - 1)], TELEM_SAMPLE_SIZE);
+    TELEM_BARRIER();
+    telemRing.tail = tail;
+    _Queue(raw, TELEM_HEADER + TELEM_BATCH * TELEM_SAMPLE_SIZE, TELEM_BATCH);
+}
+
+// Emission de la plus ancienne trame : un octet par événement UART1 TX
+static void _Send(const TELEM_FRAME *f)
+{
+    PLIB_DMA_ChannelXSourceStartAddressSet(DMA_ID_0, TELEM_DMA_CH, KVA_TO_PA(f->data));
+    PLIB_DMA_ChannelXSourceSizeSet(DMA_ID_0, TELEM_DMA_CH, f->len);
+    PLIB_DMA_ChannelXINTSourceFlagClear(DMA_ID_0, TELEM_DMA_CH, DMA_INT_BLOCK_TRANSFER_COMPLETE);
+    PLIB_DMA_ChannelXEnable(DMA_ID_0, TELEM_DMA_CH);
+    telemBusy = true;
+}
+
+//------------------------------------------------------------------------------
+// TELEM_Initialize
+//
+// UART1 8N1 à TELEM_BAUD (BRGH), interruption d'émission sur FIFO non
+// pleine : c'est l'événement qui cadence le DMA. Le canal DMA écrit
+// toujours dans U1TXREG (destination d'un octet), sa source est la trame.
+//------------------------------------------------------------------------------
+
+void TELEM_Initialize(const TELEM_INFO *info)
+{
+    telemRing.enabled = false;
+    telemInfo = *info;
+
+    PLIB_USART_BaudRateHighEnable(USART_ID_1);
+    PLIB_USART_BaudRateSet(USART_ID_1, SYS_CLK_BUS_PERIPHERAL_1, TELEM_BAUD);
+    PLIB_USART_LineControlModeSelect(USART_ID_1, USART_8N1);
+    PLIB_USART_TransmitterInterruptModeSelect(USART_ID_1, USART_TRANSMIT_FIFO_NOT_FULL);
+    PLIB_USART_TransmitterEnable(USART_ID_1);
+    PLIB_USART_Enable(USART_ID_1);
+
+    PLIB_DMA_Enable(DMA_ID_0);
+    PLIB_DMA_ChannelXPrioritySelect(DMA_ID_0, TELEM_DMA_CH, DMA_CHANNEL_PRIORITY_0);
+    PLIB_DMA_ChannelXStartIRQSet(DMA_ID_0, TELEM_DMA_CH, DMA_TRIGGER_USART_1_TRANSMIT);
+    PLIB_DMA_ChannelXTriggerEnable(DMA_ID_0, TELEM_DMA_CH, DMA_CHANNEL_TRIGGER_TRANSFER_START);
+    PLIB_DMA_ChannelXDestinationStartAddressSet(DMA_ID_0, TELEM_DMA_CH,
+            KVA_TO_PA(PLIB_USART_TransmitterAddressGet(USART_ID_1)));
+    PLIB_DMA_ChannelXDestinationSizeSet(DMA_ID_0, TELEM_DMA_CH, 1);
+    PLIB_DMA_ChannelXCellSizeSet(DMA_ID_0, TELEM_DMA_CH, 1);
+
+    // INFO en tête de flux : le décodeur connaît les échelles
+    telemOut = 0;
+    telemCount = 0;
+    telemBusy = false;
+    telemInfoIn = TELEM_INFO_FRAMES;
+    _QueueInfo();
+
+    telemRing.tail = telemRing.head;
+    telemRing.enabled = true;
+}
+
+//------------------------------------------------------------------------------
+// TELEM_Tasks
+//
+// Sans attente : libère la trame émise, remplit la file tant qu'un lot
+// complet est disponible, relance le DMA.
+//------------------------------------------------------------------------------
+
+void TELEM_Tasks(void)
+{
+    if (telemBusy && PLIB_DMA_ChannelXINTSourceFlagGet(DMA_ID_0, TELEM_DMA_CH,
+                                                       DMA_INT_BLOCK_TRANSFER_COMPLETE))
+    {
+        const TELEM_FRAME *f = &telemFrame[telemOut];
+
+        telemStats.samples += f->samples;
+        telemStats.frames++;
+        telemStats.bytes += f->len;
+        telemOut ^= 1;
+        telemCount--;
+        telemBusy = false;
+    }
+
+    while (telemCount < 2)
+    {
+        if (telemInfoIn == 0)
+        {
+            telemInfoIn = TELEM_INFO_FRAMES;
+            _QueueInfo();
+        }
+        else if ((uint16_t)(telemRing.head - telemRing.tail) >= TELEM_BATCH)
+        {
+            TELEM_BARRIER();    // Echantillons lus après head
+            telemInfoIn--;
+            _QueueSamples();
+        }
+        else
+            break;
+    }
+
+    if (!telemBusy && telemCount > 0)
+        _Send(&telemFrame[telemOut]);
+}
+
+void TELEM_StatsGet(TELEM_STATS *stats)
+{
+    *stats = telemStats;
+    stats->dropped = telemRing.dropped;
+}
+
+void TELEM_IlimSet(uint16_t thresholdmA, uint32_t count)
+{
+    if (thresholdmA != telemInfo.ilimmA)
+        telemInfoIn = 0;            // INFO au prochain TELEM_Tasks
+    telemInfo.ilimmA = thresholdmA;
+    telemInfo.ilimCount = count;
+}
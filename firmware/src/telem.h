@@ -0,0 +1,171 @@
+//--------------------------------------------------------
+//      telem.h
+//--------------------------------------------------------
+//	Description :	Télémétrie binaire sur UART1 (TX : RPB4, broche 11)
+//                  Un échantillon par pas de régulation, émis en
+//                  trames COBS par DMA, sans interruption.
+//
+//  Chaîne :
+//      ISR de régulation : TELEM_Push() recopie l'échantillon dans un
+//          anneau. Producteur unique, consommateur unique : l'index
+//          d'écriture n'est modifié que par l'ISR, celui de lecture que
+//          par la tâche, aucun verrou ni masquage d'interruption.
+//      TELEM_Tasks() (boucle principale) : TELEM_BATCH échantillons par
+//          trame, CRC-16, encodage COBS, délimiteur 0x00.
+//      DMA canal TELEM_DMA_CH : trame -> U1TXREG, un octet à chaque
+//          place libre dans la FIFO d'émission (déclenchement par
+//          l'événement UART1 TX, interruption non validée).
+//  Deux tampons de trame : l'un est émis pendant que l'autre se remplit.
+//  Anneau plein (boucle principale en retard, débit insuffisant) :
+//  l'échantillon est perdu et compté, son numéro de pas manque dans le
+//  flux.
+//
+//  Trame, avant COBS (entiers petit-boutistes, format natif du PIC32) :
+//      0       TELEM_FRAME_SAMPLES
+//      1       nombre n d'échantillons
+//      2..3    échantillons perdus depuis le démarrage (modulo 2^16)
+//      4..     n x TELEM_SAMPLE (12 octets)
+//      n+4..   CRC-16/CCITT-FALSE (0x1021, init 0xFFFF) des octets
+//              précédents
+//  Trame INFO, au démarrage puis toutes les TELEM_INFO_FRAMES trames :
+//      0       TELEM_FRAME_INFO
+//      1       TELEM_VERSION
+//      2..3    fréquence des échantillons (Hz)
+//      4..7    LSB de Vout (V par code, float)
+//      8..11   LSB de Iout (A par code, float)
+//      12..13  période PWM (ticks de Timer2, pleine échelle de duty)
+//      14      format du terme intégral (TELEM_INTEG_xxx)
+//      15..16  seuil crête de la limitation cycle par cycle (mA, effectif)
+//      17..20  impulsions tronquées par la limitation depuis le démarrage
+//      21..22  CRC
+//  Un changement du seuil (APP_CurrentLimitSet) relance une trame INFO.
+//
+//  Débit : 8 échantillons = 102 octets + 2 (COBS, délimiteur) ; à 10 kHz,
+//  130 ko/s, soit 65 % de TELEM_BAUD.
+//--------------------------------------------------------
+
+#ifndef TELEM_H
+#define TELEM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TELEM_BAUD          2000000ul   // 8N1, BRGH : PBCLK / 4 / 6
+#define TELEM_RING          64          // Echantillons (puissance de 2)
+#define TELEM_BATCH         8           // Echantillons par trame
+#define TELEM_INFO_FRAMES   1024        // Trames entre deux INFO
+#define TELEM_VERSION       2
+
+#define TELEM_FRAME_SAMPLES 0x01
+#define TELEM_FRAME_INFO    0x02
+
+// Bits de poids fort de TELEM_SAMPLE.vOut (code ADC sur 10 bits)
+#define TELEM_CODE_MASK     0x03FF
+#define TELEM_FLAG_RAMP     0x2000      // Démarrage progressif en cours
+#define TELEM_FLAG_ILIM     0x4000      // Limitation cycle par cycle
+#define TELEM_FLAG_FAULT    0x8000      // faultState : étage coupé
+
+// Contenu de TELEM_SAMPLE.integ
+#define TELEM_INTEG_Q31     0x00        // Terme intégral Q31 (virgule fixe)
+#define TELEM_INTEG_FLOAT   0x01        // float (bits IEEE 754)
+#define TELEM_INTEG_OUTPUT  0x02        // Sortie du compensateur (3P3Z)
+
+typedef struct
+{
+    uint16_t seq;           // Numéro du pas de régulation (modulo 2^16)
+    uint16_t vOut;          // Code AN11 | TELEM_FLAG_xxx
+    uint16_t iOut;          // Code AN12
+    uint16_t duty;          // OC1RS
+    uint32_t integ;         // Voir TELEM_INTEG_xxx
+} TELEM_SAMPLE;
+
+#define TELEM_SAMPLE_SIZE   12          // sizeof(TELEM_SAMPLE), sans remplissage
+
+typedef struct
+{
+    uint16_t sampleHz;      // Fréquence des échantillons
+    float    lsbVout;       // V par code
+    float    lsbIout;       // A par code
+    uint16_t dutyFull;      // OC1RS de 100 %
+    uint8_t  integFormat;   // TELEM_INTEG_xxx
+    uint16_t ilimmA;        // Seuil crête de la limitation (mA)
+    uint32_t ilimCount;     // Impulsions tronquées
+} TELEM_INFO;
+
+typedef struct
+{
+    uint32_t samples;       // Echantillons émis
+    uint32_t frames;        // Trames émises (INFO comprises)
+    uint32_t bytes;         // Octets confiés au DMA
+    uint16_t dropped;       // Echantillons perdus (anneau plein)
+} TELEM_STATS;
+
+// Anneau partagé avec l'ISR (TELEM_Push en ligne)
+typedef struct
+{
+    TELEM_SAMPLE sample[TELEM_RING];
+    volatile uint16_t head; // Ecrit par l'ISR uniquement
+    volatile uint16_t tail; // Ecrit par TELEM_Tasks uniquement
+    volatile uint16_t dropped;
+    uint16_t seq;
+    bool     enabled;
+} TELEM_RING_BUFFER;
+
+extern TELEM_RING_BUFFER telemRing;
+
+// Barrière compilateur : les accès aux échantillons (non volatils) ne
+// franchissent pas la lecture ou l'écriture de head et de tail
+#define TELEM_BARRIER()     __asm__ volatile("" ::: "memory")
+
+// UART1, DMA et trame INFO ; les échantillons sont acceptés ensuite
+void TELEM_Initialize(const TELEM_INFO *info);
+
+// Boucle principale : fin d'émission, mise en trame, lancement du DMA
+void TELEM_Tasks(void);
+
+void TELEM_StatsGet(TELEM_STATS *stats);
+
+// Limitation cycle par cycle reprise par les trames INFO suivantes
+// (boucle principale). Un seuil différent relance une trame INFO.
+void TELEM_IlimSet(uint16_t thresholdmA, uint32_t count);
+
+//------------------------------------------------------------------------------
+// TELEM_Push
+//
+// Appelée une fois par pas de régulation (ISR ADC) : quelques lectures
+// et cinq écritures, aucun appel.
+//------------------------------------------------------------------------------
+
+static inline void TELEM_Push(uint16_t vOut, uint16_t iOut, uint16_t duty, uint32_t integ)
+{
+    uint16_t head = telemRing.head;
+    uint16_t seq = telemRing.seq++;
+    TELEM_SAMPLE *s;
+
+    if (!telemRing.enabled)
+        return;
+    if ((uint16_t)(head - telemRing.tail) >= TELEM_RING)
+    {
+        telemRing.dropped++;
+        return;
+    }
+    s = &telemRing.sample[head & (TELEM_RING - 1)];
+    s->seq = seq;
+    s->vOut = vOut;
+    s->iOut = iOut;
+    s->duty = duty;
+    s->integ = integ;
+    TELEM_BARRIER();
+    telemRing.head = head + 1; // Publication après l'écriture complète
+}
+
+// Bits d'un float (terme intégral de la régulation flottante)
+static inline uint32_t TELEM_FloatBits(float x)
+{
+    union { float f; uint32_t u; } v;
+
+    v.f = x;
+    return v.u;
+}
+
+#endif